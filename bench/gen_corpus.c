@@ -0,0 +1,479 @@
+// Deterministic synthetic corpus for benchmarking pngz. Writes images of the
+// kinds pngz meets in practice, at any resolution, in the natural format of
+// each kind or in every color type and bit depth PNG allows:
+//
+//   photo     smooth multi-octave noise with grain, like a photograph
+//   ui        flat panels with borders, title bars and lines of text
+//   gradient  16-bit linear and radial ramps
+//   sprites   a sheet of anti-aliased shapes on a transparent background
+//   palette   pixel art in 16 colors
+//
+// Every pixel is a pure function of its position and the seed, so the same
+// arguments always give the same files, and images are written a row at a
+// time, so memory stays flat whatever the size.
+//
+// Build with "make gencorpus", or make the default set with "make synthetic".
+
+#include "png.h" // libpng
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+static const char *msg_help =
+        "Usage: pngz-gencorpus [options] <output_dir>\r\n"
+        "       --size <w>x<h>       image size (default 1024x1024)\r\n"
+        "       --megapixels <n>     square image of about <n> megapixels\r\n"
+        "       --seed <n>           seed (default 1)\r\n"
+        "       --kind <name>        only this kind, may be repeated:\r\n"
+        "                            photo, ui, gradient, sprites, palette\r\n"
+        "       --all-formats        every color type and bit depth, not\r\n"
+        "                            only each kind's natural one\r\n";
+
+typedef struct sample_s {
+    uint16_t r, g, b, a;
+} sample;
+
+typedef struct gen_s {
+    uint32_t width;
+    uint32_t height;
+    uint32_t seed;
+} gen;
+
+typedef void (*row_func)(const gen*, uint32_t y, sample *row);
+
+typedef struct kind_s {
+    const char *name;
+    row_func row;
+    uint8_t color_type; // Natural format
+    uint8_t bit_depth;
+} kind;
+
+typedef struct format_s {
+    uint8_t color_type;
+    uint8_t bit_depth;
+} format;
+
+static const format formats[] = {
+    {0, 1}, {0, 2}, {0, 4}, {0, 8}, {0, 16},
+    {2, 8}, {2, 16},
+    {3, 1}, {3, 2}, {3, 4}, {3, 8},
+    {4, 8}, {4, 16},
+    {6, 8}, {6, 16}
+};
+
+// RANDOMNESS ////////////////////////////////////////////////
+
+static uint32_t hash3(uint32_t a, uint32_t b, uint32_t c) {
+    uint32_t h = a * 0x9e3779b1u ^ b * 0x85ebca77u ^ c * 0xc2b2ae3du;
+    h ^= h >> 16;
+    h *= 0x7feb352du;
+    h ^= h >> 15;
+    h *= 0x846ca68bu;
+    h ^= h >> 16;
+    return h;
+}
+
+// Uniform in [0, 1].
+static double unit(uint32_t h) {
+    return h / 4294967295.0;
+}
+
+// Smoothly interpolated lattice noise in [0, 1] with the given cell size.
+static double value_noise(uint32_t x, uint32_t y, uint32_t scale,
+                          uint32_t seed) {
+    const uint32_t cx = x / scale, cy = y / scale;
+    double fx = (double)(x % scale) / scale;
+    double fy = (double)(y % scale) / scale;
+    fx = fx * fx * (3 - 2 * fx);
+    fy = fy * fy * (3 - 2 * fy);
+    const double v00 = unit(hash3(cx, cy, seed));
+    const double v10 = unit(hash3(cx + 1, cy, seed));
+    const double v01 = unit(hash3(cx, cy + 1, seed));
+    const double v11 = unit(hash3(cx + 1, cy + 1, seed));
+    const double top = v00 + (v10 - v00) * fx;
+    const double bottom = v01 + (v11 - v01) * fx;
+    return top + (bottom - top) * fy;
+}
+
+static uint16_t clamp16(double v) {
+    if(v <= 0) return 0;
+    if(v >= 1) return 65535;
+    return (uint16_t)(v * 65535 + 0.5);
+}
+
+static sample rgb8(uint32_t rgb, uint8_t alpha) {
+    sample s;
+    s.r = ((rgb >> 16) & 0xff) * 257;
+    s.g = ((rgb >> 8) & 0xff) * 257;
+    s.b = (rgb & 0xff) * 257;
+    s.a = alpha * 257;
+    return s;
+}
+
+// KINDS ////////////////////////////////////////////////
+
+static void photo_row(const gen *g, uint32_t y, sample *row) {
+    uint32_t x;
+    for(x=0;x<g->width;x++) {
+        const double luma = 0.55 * value_noise(x, y, 256, g->seed) +
+                            0.30 * value_noise(x, y, 48, g->seed + 1) +
+                            0.10 * value_noise(x, y, 9, g->seed + 2) +
+                            0.05 * unit(hash3(x, y, g->seed + 3));
+        const double warm = value_noise(x, y, 384, g->seed + 4) - 0.5;
+        const double green = value_noise(x, y, 512, g->seed + 5) - 0.5;
+        row[x].r = clamp16(luma + 0.25 * warm);
+        row[x].g = clamp16(luma + 0.15 * green);
+        row[x].b = clamp16(luma - 0.25 * warm);
+        row[x].a = 65535;
+    }
+}
+
+// Pseudo glyph: 5x7 bits from the character's hash, blank for spaces.
+static bool glyph_bit(uint32_t ch, uint32_t gx, uint32_t gy, uint32_t seed) {
+    if(gx >= 5 || gy >= 7 || hash3(ch, 0, seed) % 6 == 0) {
+        return false;
+    }
+    return (hash3(ch % 64, gy, seed) >> gx) & 1;
+}
+
+static void ui_row(const gen *g, uint32_t y, sample *row) {
+    static const uint32_t panels[4] = {0xffffff, 0xf7f7f9, 0xeef1f5, 0xfdf6e3};
+    static const uint32_t accents[4] = {0x3b6fd4, 0x2f9e62, 0x8e44ad, 0x555b66};
+    const uint32_t cell_w = 320, cell_h = 240;
+    const uint32_t cy = y / cell_h, ly = y % cell_h;
+    uint32_t x;
+    for(x=0;x<g->width;x++) {
+        const uint32_t cx = x / cell_w, lx = x % cell_w;
+        const uint32_t h = hash3(cx, cy, g->seed);
+        const uint32_t inset = 6 + h % 24;
+        uint32_t color = 0xd9dce1; // Desktop
+        if(lx >= inset && lx < cell_w - inset &&
+           ly >= inset && ly < cell_h - inset) {
+            const uint32_t px = lx - inset, py = ly - inset;
+            const uint32_t pw = cell_w - 2 * inset, ph = cell_h - 2 * inset;
+            if(px == 0 || py == 0 || px == pw - 1 || py == ph - 1) {
+                color = 0x9aa0a8; // Border
+            }
+            else if(py < 22) {
+                color = accents[(h >> 8) % 4]; // Title bar
+                if(py >= 8 && py < 15 && px >= 8 && px < pw / 2 &&
+                   glyph_bit(h + (px - 8) / 6, (px - 8) % 6, py - 8,
+                             g->seed)) {
+                    color = 0xffffff;
+                }
+            }
+            else {
+                color = panels[(h >> 12) % 4];
+                // Text lines of varying length below the title bar
+                const uint32_t line = (py - 22) / 14, ty = (py - 22) % 14;
+                const uint32_t length = hash3(cx, cy * 1024 + line, g->seed)
+                                        % (pw > 40 ? pw - 24 : 1);
+                if(ty >= 4 && ty < 11 && px >= 12 && px < 12 + length &&
+                   py < ph - 10 &&
+                   glyph_bit(hash3(h, line, (px - 12) / 6), (px - 12) % 6,
+                             ty - 4, g->seed)) {
+                    color = 0x24292e;
+                }
+            }
+        }
+        row[x] = rgb8(color, 255);
+    }
+}
+
+static void gradient_row(const gen *g, uint32_t y, sample *row) {
+    const double cx = g->width / 2.0, cy = g->height / 2.0;
+    const double radius = sqrt(cx * cx + cy * cy);
+    const double fy = g->height > 1 ? (double)y / (g->height - 1) : 0;
+    uint32_t x;
+    for(x=0;x<g->width;x++) {
+        const double fx = g->width > 1 ? (double)x / (g->width - 1) : 0;
+        const double d = sqrt((x - cx) * (x - cx) + (y - cy) * (y - cy));
+        row[x].r = clamp16(fx);
+        row[x].g = clamp16(fy);
+        row[x].b = clamp16(1 - d / radius);
+        row[x].a = 65535;
+    }
+}
+
+static void sprites_row(const gen *g, uint32_t y, sample *row) {
+    const uint32_t cell = 64;
+    const uint32_t cy = y / cell;
+    const double ly = y % cell + 0.5 - cell / 2.0;
+    uint32_t x;
+    for(x=0;x<g->width;x++) {
+        const uint32_t cx = x / cell;
+        const uint32_t h = hash3(cx, cy, g->seed);
+        const double lx = x % cell + 0.5 - cell / 2.0;
+        const double rx = 12 + h % 18, ry = 12 + (h >> 5) % 18;
+        // Signed distance to the ellipse edge, roughly in pixels.
+        const double d = (sqrt(lx*lx/(rx*rx) + ly*ly/(ry*ry)) - 1) *
+                         (rx < ry ? rx : ry);
+        if(d >= 1) {
+            row[x].r = row[x].g = row[x].b = row[x].a = 0;
+            continue;
+        }
+        const uint32_t body = hash3(h, 1, g->seed) & 0xffffff;
+        uint32_t color = body;
+        if(d > -2) {
+            color = (body >> 1) & 0x7f7f7f; // Outline
+        }
+        else if(lx < -rx / 3 && ly < -ry / 3) {
+            color = body | 0x606060; // Highlight
+        }
+        row[x] = rgb8(color, 255);
+        if(d > 0) {
+            row[x].a = clamp16(1 - d); // Anti-aliased edge
+        }
+    }
+}
+
+// The colors of the 16 entry RGB cube (1 bit red, 2 green, 1 blue), so
+// the image maps onto a 4-bit palette exactly.
+static uint32_t cube16(uint32_t i) {
+    const uint32_t r = (i >> 3) & 1, g = (i >> 1) & 3, b = i & 1;
+    return (r * 255) << 16 | (g * 85) << 8 | b * 255;
+}
+
+static void palette_row(const gen *g, uint32_t y, sample *row) {
+    uint32_t x;
+    for(x=0;x<g->width;x++) {
+        // Large areas of one color, with smaller tiles and dithered
+        // stripes mixing in a neighbor.
+        const uint32_t area = hash3(x / 96, y / 96, g->seed) % 16;
+        const uint32_t tile = hash3(x / 8, y / 8, g->seed + 1) % 8;
+        uint32_t i = area;
+        if(tile == 0) {
+            i = (area + 1) % 16;
+        }
+        else if(tile == 1 && (x + y) % 2 == 0) {
+            i = (area + 5) % 16;
+        }
+        row[x] = rgb8(cube16(i), 255);
+    }
+}
+
+static const kind kinds[] = {
+    {"photo", photo_row, 2, 8},
+    {"ui", ui_row, 2, 8},
+    {"gradient", gradient_row, 2, 16},
+    {"sprites", sprites_row, 6, 8},
+    {"palette", palette_row, 3, 4}
+};
+#define KIND_COUNT (sizeof(kinds) / sizeof(kinds[0]))
+
+// FORMATS ////////////////////////////////////////////////
+
+static uint16_t luma(sample s) {
+    return (uint16_t)((s.r * 77u + s.g * 150u + s.b * 29u) >> 8);
+}
+
+// Palette index of a sample: a 3-3-2 RGB cube at depth 8, the 1-2-1 cube
+// at depth 4 and grey levels below that.
+static uint8_t palette_index(sample s, uint8_t depth) {
+    if(depth == 8) {
+        return (s.r >> 13) << 5 | (s.g >> 13) << 2 | (s.b >> 14);
+    }
+    if(depth == 4) {
+        return (s.r >> 15) << 3 | (s.g >> 14) << 1 | (s.b >> 15);
+    }
+    return luma(s) >> (16 - depth);
+}
+
+static void make_palette(uint8_t depth, png_color *palette, int *size) {
+    int i;
+    *size = 1 << depth;
+    for(i=0;i<*size;i++) {
+        if(depth == 8) {
+            palette[i].red = ((i >> 5) & 7) * 255 / 7;
+            palette[i].green = ((i >> 2) & 7) * 255 / 7;
+            palette[i].blue = (i & 3) * 255 / 3;
+        }
+        else if(depth == 4) {
+            const uint32_t c = cube16(i);
+            palette[i].red = c >> 16;
+            palette[i].green = (c >> 8) & 0xff;
+            palette[i].blue = c & 0xff;
+        }
+        else {
+            palette[i].red = palette[i].green = palette[i].blue =
+                i * 255 / (*size - 1);
+        }
+    }
+}
+
+// Packs a row of samples into the bytes of the given format.
+static void pack_row(const sample *row, uint32_t width, format f,
+                     uint8_t *out) {
+    uint16_t values[4];
+    int n = 0, i;
+    uint32_t x;
+    size_t bit = 0;
+    const size_t row_bits = (size_t)width * f.bit_depth *
+        (f.color_type == 2 ? 3 : f.color_type == 4 ? 2 :
+         f.color_type == 6 ? 4 : 1);
+    memset(out, 0, (row_bits + 7) / 8);
+
+    for(x=0;x<width;x++) {
+        const sample s = row[x];
+        switch(f.color_type) {
+        case 0: values[0] = luma(s); n = 1; break;
+        case 2: values[0] = s.r; values[1] = s.g; values[2] = s.b; n = 3; break;
+        case 3: values[0] = palette_index(s, f.bit_depth); n = 1; break;
+        case 4: values[0] = luma(s); values[1] = s.a; n = 2; break;
+        default:
+            values[0] = s.r; values[1] = s.g; values[2] = s.b; values[3] = s.a;
+            n = 4;
+        }
+        for(i=0;i<n;i++) {
+            uint16_t v = values[i];
+            if(f.color_type != 3) {
+                v >>= 16 - f.bit_depth;
+            }
+            if(f.bit_depth == 16) {
+                out[bit / 8] = v >> 8;
+                out[bit / 8 + 1] = v & 0xff;
+            }
+            else if(f.bit_depth == 8) {
+                out[bit / 8] = (uint8_t)v;
+            }
+            else {
+                out[bit / 8] |= v << (8 - f.bit_depth - bit % 8);
+            }
+            bit += f.bit_depth;
+        }
+    }
+}
+
+static void png_error_exit(png_structp png_ptr, png_const_charp message) {
+    (void)png_ptr;
+    printf("libpng: %s\r\n", message);
+    exit(1);
+}
+
+static void write_image(const gen *g, const kind *k, format f,
+                        const char *path) {
+    FILE *fp = fopen(path, "wb");
+    if(!fp) {
+        printf("Could not open '%s' for writing\r\n", path);
+        exit(1);
+    }
+    png_structp png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING,
+                                                  NULL, png_error_exit, NULL);
+    png_infop info_ptr = png_create_info_struct(png_ptr);
+    if(!png_ptr || !info_ptr) {
+        printf("Could not write '%s'\r\n", path);
+        exit(1);
+    }
+    png_init_io(png_ptr, fp);
+    // These are inputs, not results: write them fast.
+    png_set_compression_level(png_ptr, 1);
+    png_set_IHDR(png_ptr, info_ptr, g->width, g->height, f.bit_depth,
+                 f.color_type, PNG_INTERLACE_NONE,
+                 PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    if(f.color_type == 3) {
+        png_color palette[256];
+        int size;
+        make_palette(f.bit_depth, palette, &size);
+        png_set_PLTE(png_ptr, info_ptr, palette, size);
+    }
+    png_write_info(png_ptr, info_ptr);
+
+    sample *row = malloc(sizeof(sample) * g->width);
+    uint8_t *packed = malloc((size_t)g->width * 8);
+    uint32_t y;
+    for(y=0;y<g->height;y++) {
+        k->row(g, y, row);
+        pack_row(row, g->width, f, packed);
+        png_write_row(png_ptr, packed);
+    }
+    png_write_end(png_ptr, NULL);
+    png_destroy_write_struct(&png_ptr, &info_ptr);
+    fclose(fp);
+    free(row);
+    free(packed);
+}
+
+int main(int argc, char *argv[]) {
+    gen g = {1024, 1024, 1};
+    bool selected[KIND_COUNT] = {false};
+    bool any_selected = false;
+    bool all_formats = false;
+    const char *dir = NULL;
+    size_t i, j;
+    int a;
+
+    for(a=1;a<argc;a++) {
+        if(!strcmp(argv[a], "-h") || !strcmp(argv[a], "--help")) {
+            printf("%s\n", msg_help);
+            return 0;
+        }
+        else if(!strcmp(argv[a], "--size") && a+1 < argc) {
+            if(sscanf(argv[++a], "%ux%u", &g.width, &g.height) != 2) {
+                printf("Invalid size '%s'\r\n", argv[a]);
+                return 1;
+            }
+        }
+        else if(!strcmp(argv[a], "--megapixels") && a+1 < argc) {
+            g.width = g.height = (uint32_t)sqrt(strtod(argv[++a], NULL) * 1e6);
+        }
+        else if(!strcmp(argv[a], "--seed") && a+1 < argc) {
+            g.seed = (uint32_t)strtoul(argv[++a], NULL, 10);
+        }
+        else if(!strcmp(argv[a], "--kind") && a+1 < argc) {
+            a++;
+            for(i=0;i<KIND_COUNT && strcmp(kinds[i].name, argv[a]);i++);
+            if(i == KIND_COUNT) {
+                printf("Unknown kind '%s'\r\n", argv[a]);
+                return 1;
+            }
+            selected[i] = any_selected = true;
+        }
+        else if(!strcmp(argv[a], "--all-formats")) {
+            all_formats = true;
+        }
+        else if(!dir) {
+            dir = argv[a];
+        }
+        else {
+            printf("%s\n", msg_help);
+            return 1;
+        }
+    }
+    if(!dir || g.width == 0 || g.height == 0) {
+        printf("%s\n", msg_help);
+        return 1;
+    }
+    if(mkdir(dir, 0777) != 0 && errno != EEXIST) {
+        printf("Could not create '%s'\r\n", dir);
+        return 1;
+    }
+
+    const size_t path_size = strlen(dir) + 64;
+    char *path = malloc(path_size);
+    for(i=0;i<KIND_COUNT;i++) {
+        const kind *k = &kinds[i];
+        if(any_selected && !selected[i]) {
+            continue;
+        }
+        for(j=0;j<sizeof(formats)/sizeof(formats[0]);j++) {
+            const format f = formats[j];
+            if(!all_formats && (f.color_type != k->color_type ||
+                                f.bit_depth != k->bit_depth)) {
+                continue;
+            }
+            snprintf(path, path_size, "%s/%s-%ux%u-s%u-ct%d-%d.png", dir,
+                     k->name, g.width, g.height, g.seed, f.color_type,
+                     f.bit_depth);
+            write_image(&g, k, f, path);
+            printf("%s\r\n", path);
+        }
+    }
+    free(path);
+    return 0;
+}
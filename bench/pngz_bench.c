@@ -0,0 +1,387 @@
+// Corpus benchmark for pngz. Runs bin/pngz on every image a number of
+// times and reports, per image, the median wall and CPU time, the peak
+// resident set size and the output size, and for the whole corpus the time
+// spent in each stage of the --trace output. Results can be saved as a
+// baseline and later runs compared against it, flagging any image whose
+// output grew or whose time or memory grew by more than a threshold.
+//
+// Build and run with "make bench".
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#define MAX_RUNS 101
+#define MAX_STAGES 32
+
+// Time differences below this are noise, whatever the threshold says.
+#define MIN_SECONDS 0.02
+
+static const char *msg_help =
+        "Usage: pngz-bench [options] <image>...\r\n"
+        "       -n <runs>                runs per image (default 3)\r\n"
+        "       --pngz <path>            binary to benchmark (default bin/pngz)\r\n"
+        "       --out <dir>              where outputs and traces go\r\n"
+        "       --baseline <file>        compare against <file>\r\n"
+        "       --save-baseline <file>   record the results in <file>\r\n"
+        "       --threshold <percent>    allowed time and memory growth\r\n"
+        "                                (default 10)\r\n"
+        "       -- <args>                pass the remaining args to pngz\r\n";
+
+typedef struct bench_options_s {
+    int runs;
+    const char *pngz;
+    const char *out_dir;
+    const char *baseline;
+    const char *save_baseline;
+    double threshold;
+    char **pngz_args;
+    int pngz_argc;
+    char **images;
+    int image_count;
+} bench_options;
+
+typedef struct image_result_s {
+    const char *image;
+    double wall;     // Median over runs
+    double cpu;      // Median over runs
+    long rss_kb;     // Peak over runs
+    long size;       // Output bytes
+} image_result;
+
+typedef struct stage_totals_s {
+    char names[MAX_STAGES][32];
+    double seconds[MAX_STAGES];
+    int size;
+} stage_totals;
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int cmp_double(const void *a, const void *b) {
+    const double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static double median(double *values, int n) {
+    qsort(values, n, sizeof(double), cmp_double);
+    return n % 2 ? values[n/2] : (values[n/2 - 1] + values[n/2]) / 2;
+}
+
+static void parse_opts(bench_options *options, int argc, char *argv[]) {
+    int i;
+    options->runs = 3;
+    options->pngz = "bin/pngz";
+    options->out_dir = "build/bench";
+    options->baseline = NULL;
+    options->save_baseline = NULL;
+    options->threshold = 10;
+    options->pngz_args = NULL;
+    options->pngz_argc = 0;
+    options->images = malloc(sizeof(char*) * argc);
+    options->image_count = 0;
+
+    for(i=1;i<argc;i++) {
+        if(!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) {
+            printf("%s\n", msg_help);
+            exit(0);
+        }
+        else if(!strcmp(argv[i], "-n") && i+1 < argc) {
+            options->runs = atoi(argv[++i]);
+        }
+        else if(!strcmp(argv[i], "--pngz") && i+1 < argc) {
+            options->pngz = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--out") && i+1 < argc) {
+            options->out_dir = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--baseline") && i+1 < argc) {
+            options->baseline = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--save-baseline") && i+1 < argc) {
+            options->save_baseline = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--threshold") && i+1 < argc) {
+            options->threshold = strtod(argv[++i], NULL);
+        }
+        else if(!strcmp(argv[i], "--")) {
+            options->pngz_args = argv + i + 1;
+            options->pngz_argc = argc - i - 1;
+            break;
+        }
+        else {
+            options->images[options->image_count++] = argv[i];
+        }
+    }
+    if(options->image_count == 0 || options->runs < 1 ||
+       options->runs > MAX_RUNS) {
+        printf("%s\n", msg_help);
+        exit(1);
+    }
+}
+
+// Runs pngz once on image, returning its wall and CPU time and peak RSS.
+static void run_once(const bench_options *options, const char *image,
+                     const char *output, const char *trace,
+                     double *wall, double *cpu, long *rss_kb) {
+    char **argv = malloc(sizeof(char*) * (options->pngz_argc + 6));
+    int argc = 0, i;
+    argv[argc++] = (char *)options->pngz;
+    argv[argc++] = "--trace";
+    argv[argc++] = (char *)trace;
+    for(i=0;i<options->pngz_argc;i++) {
+        argv[argc++] = options->pngz_args[i];
+    }
+    argv[argc++] = (char *)image;
+    argv[argc++] = (char *)output;
+    argv[argc] = NULL;
+
+    const double start = now();
+    pid_t pid = fork();
+    if(pid < 0) {
+        printf("Could not fork\r\n");
+        exit(1);
+    }
+    if(pid == 0) {
+        int devnull = open("/dev/null", O_WRONLY);
+        dup2(devnull, STDOUT_FILENO);
+        execv(options->pngz, argv);
+        _exit(127);
+    }
+
+    int status;
+    struct rusage usage;
+    if(wait4(pid, &status, 0, &usage) < 0 || !WIFEXITED(status) ||
+       WEXITSTATUS(status) != 0) {
+        printf("'%s' failed on '%s'\r\n", options->pngz, image);
+        exit(1);
+    }
+    *wall = now() - start;
+    *cpu = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6 +
+           usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+    *rss_kb = usage.ru_maxrss;
+    free(argv);
+}
+
+static void add_stage(stage_totals *totals, const char *name, double seconds) {
+    int i;
+    for(i=0;i<totals->size;i++) {
+        if(!strcmp(totals->names[i], name)) {
+            totals->seconds[i] += seconds;
+            return;
+        }
+    }
+    if(totals->size == MAX_STAGES) {
+        return;
+    }
+    snprintf(totals->names[i], sizeof(totals->names[i]), "%s", name);
+    totals->seconds[i] = seconds;
+    totals->size++;
+}
+
+// Adds the stage times of a trace file to totals, scaled by weight, with
+// compress split into its zopfli phases. Only the members pngz itself writes
+// are looked at, so this is no JSON parser.
+static void read_trace(const char *path, stage_totals *totals, double weight) {
+    static const char *phases[4] = {"blocksplit", "greedy", "squeeze",
+                                    "encode"};
+    FILE *fp = fopen(path, "r");
+    char line[4096];
+    int i;
+    if(!fp) {
+        return;
+    }
+    while(fgets(line, sizeof(line), fp)) {
+        char name[32];
+        double seconds;
+        const char *stage = strstr(line, "\"stage\":\"");
+        const char *time = strstr(line, "\"seconds\":");
+        if(!stage || !time ||
+           sscanf(stage + 9, "%31[^\"]", name) != 1 ||
+           sscanf(time + 10, "%lf", &seconds) != 1) {
+            continue;
+        }
+        if(strcmp(name, "result")) { // result is the total
+            add_stage(totals, name, seconds * weight);
+        }
+        for(i=0;strcmp(name, "compress") == 0 && i<4;i++) {
+            char member[32], phase[32];
+            snprintf(member, sizeof(member), "\"%s\":", phases[i]);
+            snprintf(phase, sizeof(phase), "compress.%s", phases[i]);
+            const char *value = strstr(line, member);
+            if(value && sscanf(value + strlen(member), "%lf", &seconds) == 1) {
+                add_stage(totals, phase, seconds * weight);
+            }
+        }
+    }
+    fclose(fp);
+}
+
+static void bench_image(const bench_options *options, const char *image,
+                        image_result *result, stage_totals *totals) {
+    const char *base = strrchr(image, '/') ? strrchr(image, '/') + 1 : image;
+    const size_t length = strlen(options->out_dir) + strlen(base) + 8;
+    char *output = malloc(length);
+    char *trace = malloc(length);
+    double walls[MAX_RUNS], cpus[MAX_RUNS];
+    int run;
+
+    snprintf(output, length, "%s/%s", options->out_dir, base);
+    snprintf(trace, length, "%s/%s.jsonl", options->out_dir, base);
+    remove(trace);
+
+    result->image = image;
+    result->rss_kb = 0;
+    for(run=0;run<options->runs;run++) {
+        long rss_kb;
+        remove(output);
+        run_once(options, image, output, trace, &walls[run], &cpus[run],
+                 &rss_kb);
+        if(rss_kb > result->rss_kb) {
+            result->rss_kb = rss_kb;
+        }
+    }
+    result->wall = median(walls, options->runs);
+    result->cpu = median(cpus, options->runs);
+
+    // Older pngz builds write no output when they can't improve on the input.
+    struct stat st;
+    if(stat(output, &st) == 0 || stat(image, &st) == 0) {
+        result->size = st.st_size;
+    }
+    else {
+        result->size = -1;
+    }
+
+    read_trace(trace, totals, 1.0 / options->runs);
+    free(output);
+    free(trace);
+}
+
+static void save_baseline(const char *path, const image_result *results,
+                          int count) {
+    FILE *fp = fopen(path, "w");
+    int i;
+    if(!fp) {
+        printf("Could not write baseline '%s'\r\n", path);
+        exit(1);
+    }
+    fprintf(fp, "# image\twall\tcpu\trss_kb\tsize\n");
+    for(i=0;i<count;i++) {
+        fprintf(fp, "%s\t%.6f\t%.6f\t%ld\t%ld\n", results[i].image,
+                results[i].wall, results[i].cpu, results[i].rss_kb,
+                results[i].size);
+    }
+    fclose(fp);
+}
+
+// Whether value grew past base by more than threshold percent, and by more
+// than floor in absolute terms.
+static bool grew(double value, double base, double threshold, double floor) {
+    return value - base > floor && value > base * (1 + threshold / 100);
+}
+
+// Compares against the baseline, printing a line per changed image. Returns
+// the number of regressions.
+static int compare_baseline(const bench_options *options,
+                            const image_result *results, int count) {
+    FILE *fp = fopen(options->baseline, "r");
+    char line[4096];
+    int regressions = 0, i;
+    if(!fp) {
+        printf("no baseline at '%s'\r\n", options->baseline);
+        return 0;
+    }
+    printf("\r\ncompared to %s (threshold %.1f%%):\r\n", options->baseline,
+           options->threshold);
+    while(fgets(line, sizeof(line), fp)) {
+        char image[4096];
+        image_result base;
+        if(line[0] == '#' ||
+           sscanf(line, "%4095[^\t]\t%lf\t%lf\t%ld\t%ld", image, &base.wall,
+                  &base.cpu, &base.rss_kb, &base.size) != 5) {
+            continue;
+        }
+        for(i=0;i<count && strcmp(results[i].image, image);i++);
+        if(i == count) {
+            continue;
+        }
+        const image_result *r = &results[i];
+        const double t = options->threshold;
+        const bool size = r->size > base.size;
+        const bool wall = grew(r->wall, base.wall, t, MIN_SECONDS);
+        const bool cpu = grew(r->cpu, base.cpu, t, MIN_SECONDS);
+        const bool rss = grew(r->rss_kb, base.rss_kb, t, 1024);
+        if(size || wall || cpu || rss) {
+            regressions++;
+            printf("REGRESSION %s:%s%s%s%s\r\n", image,
+                   size ? " size" : "", wall ? " wall" : "",
+                   cpu ? " cpu" : "", rss ? " rss" : "");
+        }
+        printf("  %-32s size %7ld -> %7ld  wall %8.3f -> %8.3f  "
+               "cpu %8.3f -> %8.3f  rss %7ld -> %7ld\r\n", image,
+               base.size, r->size, base.wall, r->wall, base.cpu, r->cpu,
+               base.rss_kb, r->rss_kb);
+    }
+    fclose(fp);
+    return regressions;
+}
+
+int main(int argc, char *argv[]) {
+    bench_options options;
+    parse_opts(&options, argc, argv);
+
+    mkdir(options.out_dir, 0777);
+
+    image_result *results = malloc(sizeof(image_result) * options.image_count);
+    stage_totals totals;
+    double wall = 0, cpu = 0;
+    long size = 0;
+    int i;
+    totals.size = 0;
+
+    printf("%-32s %10s %10s %10s %10s\r\n", "image", "wall s", "cpu s",
+           "rss KB", "size B");
+    for(i=0;i<options.image_count;i++) {
+        image_result *r = &results[i];
+        bench_image(&options, options.images[i], r, &totals);
+        printf("%-32s %10.3f %10.3f %10ld %10ld\r\n", r->image, r->wall,
+               r->cpu, r->rss_kb, r->size);
+        wall += r->wall;
+        cpu += r->cpu;
+        size += r->size;
+    }
+    printf("%-32s %10.3f %10.3f %10s %10ld\r\n", "total", wall, cpu, "",
+           size);
+
+    printf("\r\nstage totals (mean per run):\r\n");
+    for(i=0;i<totals.size;i++) {
+        printf("  %-20s %10.3f s %6.1f%%\r\n", totals.names[i],
+               totals.seconds[i], wall > 0 ? totals.seconds[i]/wall*100 : 0);
+    }
+
+    int regressions = 0;
+    if(options.baseline) {
+        regressions = compare_baseline(&options, results, options.image_count);
+        printf("%d regression(s)\r\n", regressions);
+    }
+    if(options.save_baseline) {
+        save_baseline(options.save_baseline, results, options.image_count);
+        printf("baseline saved to %s\r\n", options.save_baseline);
+    }
+
+    free(results);
+    free(options.images);
+    return regressions ? 1 : 0;
+}
@@ -0,0 +1,173 @@
+// pngz-client: sends one PNG to pngzd and writes back what it returns.
+
+#include "protocol.h"
+#include "libpngz.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+static const char *msg_help =
+        "Usage: pngz-client [options] <input> <output>\r\n"
+        "       --socket <path>       daemon socket (default "
+        PNGZD_DEFAULT_SOCKET ")\r\n"
+        "       -o<0-6>               effort (default 4)\r\n"
+        "       --force               search even if the input looks optimized\r\n"
+        "       --time-budget <s>     stop searching after this many seconds\r\n"
+        "       --deadline <s>        give up if not answered in time,\r\n"
+        "                             queueing included\r\n"
+        "       --path                have the daemon read <input> itself,\r\n"
+        "                             if under its --path-root\r\n";
+
+static uint8_t* read_file(const char *path, size_t *size) {
+    FILE *fp = fopen(path, "rb");
+    if(!fp) {
+        printf("Could not open '%s'\r\n", path);
+        exit(1);
+    }
+    fseek(fp, 0L, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0L, SEEK_SET);
+    uint8_t *data = malloc(*size ? *size : 1);
+    if(fread(data, 1, *size, fp) != *size) {
+        printf("Could not read '%s'\r\n", path);
+        exit(1);
+    }
+    fclose(fp);
+    return data;
+}
+
+static const char* status_string(int32_t status) {
+    switch(status) {
+        case PNGZD_BUSY: return "daemon busy";
+        case PNGZD_EXPIRED: return "deadline passed while queued";
+        case PNGZD_BAD_REQUEST: return "bad request";
+        case PNGZD_FORBIDDEN: return "daemon doesn't serve this path";
+    }
+    return pngz_strerror((pngz_status)status);
+}
+
+int main(int argc, char *argv[]) {
+    const char *socket_path = PNGZD_DEFAULT_SOCKET;
+    const char *input = NULL;
+    const char *output = NULL;
+    pngzd_request request;
+    memset(&request, 0, sizeof(request));
+    memcpy(request.magic, "PZRQ", 4);
+    request.version = PNGZD_VERSION;
+    request.effort = PNGZ_DEFAULT_EFFORT;
+
+    int i;
+    for(i=1;i<argc;i++) {
+        if(!strcmp(argv[i], "--socket") && i+1 < argc) {
+            socket_path = argv[++i];
+        }
+        else if(argv[i][0] == '-' && argv[i][1] == 'o' && argv[i][2] >= '0' &&
+                argv[i][2] <= '9' && argv[i][3] == '\0') {
+            request.effort = argv[i][2] - '0';
+        }
+        else if(!strcmp(argv[i], "--force")) {
+            request.flags |= PNGZD_FORCE;
+        }
+        else if(!strcmp(argv[i], "--path")) {
+            request.flags |= PNGZD_PATH;
+        }
+        else if(!strcmp(argv[i], "--time-budget") && i+1 < argc) {
+            request.time_budget = atof(argv[++i]);
+        }
+        else if(!strcmp(argv[i], "--deadline") && i+1 < argc) {
+            request.deadline = atof(argv[++i]);
+        }
+        else if(argv[i][0] != '-' && !input) {
+            input = argv[i];
+        }
+        else if(argv[i][0] != '-' && !output) {
+            output = argv[i];
+        }
+        else {
+            printf("%s\n", msg_help);
+            return 1;
+        }
+    }
+    if(!input || !output) {
+        printf("%s\n", msg_help);
+        return 1;
+    }
+
+    // With --path the daemon opens the file, so it needs a path that means
+    // the same thing to it.
+    uint8_t *payload;
+    size_t payload_size;
+    if(request.flags & PNGZD_PATH) {
+        payload = (uint8_t *)realpath(input, NULL);
+        if(!payload) {
+            printf("Could not open '%s'\r\n", input);
+            return 1;
+        }
+        payload_size = strlen((char *)payload);
+    }
+    else {
+        payload = read_file(input, &payload_size);
+    }
+    request.payload_size = payload_size;
+
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, socket_path, sizeof(addr.sun_path) - 1);
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd < 0 || connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        printf("Could not connect to '%s'\r\n", socket_path);
+        return 1;
+    }
+
+    // A busy daemon answers without reading the request, so the response
+    // is still read when sending fails.
+    signal(SIGPIPE, SIG_IGN);
+    pngzd_response response;
+    if(write_full(fd, &request, sizeof(request))) {
+        write_full(fd, payload, payload_size);
+    }
+    if(!read_full(fd, &response, sizeof(response)) ||
+       memcmp(response.magic, "PZRS", 4)) {
+        printf("Lost connection to the daemon\r\n");
+        return 1;
+    }
+    free(payload);
+    if(response.status != PNGZ_OK) {
+        printf("%s: %s\r\n", input, status_string(response.status));
+        return response.status == PNGZD_BUSY ? 75 : 1; // EX_TEMPFAIL
+    }
+
+    uint8_t *png = malloc(response.payload_size ? response.payload_size : 1);
+    if(!read_full(fd, png, response.payload_size)) {
+        printf("Lost connection to the daemon\r\n");
+        return 1;
+    }
+    close(fd);
+
+    FILE *fp = fopen(output, "wb");
+    if(!fp || fwrite(png, 1, response.payload_size, fp) !=
+              response.payload_size) {
+        printf("Could not write '%s'\r\n", output);
+        return 1;
+    }
+    fclose(fp);
+    free(png);
+
+    printf("%s: %llu -> %llu bytes%s%s%s%s%s, queued %.3fs, %.3fs\r\n",
+           input,
+           (unsigned long long)response.original_size,
+           (unsigned long long)response.payload_size,
+           response.flags & PNGZD_IMPROVED ? "" : " (not improved)",
+           response.flags & PNGZD_CACHE_HIT ? " (cached)" : "",
+           response.flags & PNGZD_PASSED_THROUGH ? " (already optimized)" : "",
+           response.flags & PNGZD_DEADLINE_REACHED ? " (time budget hit)" : "",
+           response.flags & PNGZD_MEMORY_REDUCED ? " (less memory)" : "",
+           response.queued_seconds, response.seconds);
+    return 0;
+}
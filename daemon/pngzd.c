@@ -0,0 +1,505 @@
+// pngzd: pngz as a long running service. Listens on a Unix domain socket
+// (see protocol.h) and optimizes the PNGs it is sent on a fixed pool of
+// worker threads, so callers pay neither process startup nor library setup
+// per image. Connections wait in a bounded queue; when it is full new ones
+// are turned away at once with PNGZD_BUSY rather than piling up. Workers
+// read each request themselves, so the accept loop never waits on a client,
+// and requests whose deadline passes while queued are answered with
+// PNGZD_EXPIRED without being worked on. All workers share one result cache
+// directory.
+
+#include "protocol.h"
+#include "libpngz.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <limits.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+static const char *msg_help =
+        "Usage: pngzd [options]\r\n"
+        "       --socket <path>       listen here (default "
+        PNGZD_DEFAULT_SOCKET ")\r\n"
+        "       --workers <n>         worker threads (default: cores)\r\n"
+        "       --queue <n>           queued requests before turning new\r\n"
+        "                             ones away (default 4 per worker)\r\n"
+        "       --max-input <MB>      largest payload accepted (default 256)\r\n"
+        "       --memory <MB>         memory the workers' searches may take\r\n"
+        "                             at once (default: no limit)\r\n"
+        "       --cache <dir>         result cache shared by all requests\r\n"
+        "       --path-root <dir>     serve --path requests for files under\r\n"
+        "                             <dir> (default: refuse them)\r\n"
+        "       --trace <file>        append per-stage timings to <file>\r\n";
+
+// Seconds a client gets to send its whole request, payload included, once a
+// worker takes its connection, so a slow one can't hold the worker for long.
+#define RECEIVE_TIMEOUT 10
+
+typedef struct daemon_options_s {
+    const char *socket_path;
+    int workers;
+    size_t queue_size;
+    uint64_t max_input;
+    const char *cache_dir;
+    const char *trace_filename;
+    char *path_root;         // Resolved, or NULL to refuse path requests
+} daemon_options;
+
+// An accepted connection, waiting for a worker to read its request.
+typedef struct job_s {
+    int fd;
+    double arrival;
+} job;
+
+// Bounded FIFO of received requests. Idle workers count as room on top of
+// capacity, so a burst reaching an idle pool isn't turned away for a job a
+// worker is about to take; the ring has a slot for each of them too.
+typedef struct job_queue_s {
+    job *jobs;
+    size_t capacity;
+    size_t slots;
+    size_t head;
+    size_t size;
+    size_t waiting; // Workers blocked in queue_pop
+    bool closed;
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+} job_queue;
+
+static const daemon_options *daemon_opts;
+static volatile sig_atomic_t stopping = 0;
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// QUEUE ////////////////////////////////////////////////
+
+static void queue_init(job_queue *q, size_t capacity, size_t workers) {
+    q->slots = capacity + workers;
+    q->jobs = malloc(sizeof(job) * q->slots);
+    q->capacity = capacity;
+    q->head = 0;
+    q->size = 0;
+    q->waiting = 0;
+    q->closed = false;
+    pthread_mutex_init(&q->lock, NULL);
+    pthread_cond_init(&q->ready, NULL);
+}
+
+// Returns false, leaving the job with the caller, when the queue is full.
+static bool queue_push(job_queue *q, const job *j) {
+    pthread_mutex_lock(&q->lock);
+    const bool room = q->size < q->capacity + q->waiting;
+    if(room) {
+        q->jobs[(q->head + q->size++) % q->slots] = *j;
+        pthread_cond_signal(&q->ready);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return room;
+}
+
+// Blocks for the next job. Returns false once the queue is closed and empty.
+static bool queue_pop(job_queue *q, job *j) {
+    pthread_mutex_lock(&q->lock);
+    q->waiting++;
+    while(q->size == 0 && !q->closed) {
+        pthread_cond_wait(&q->ready, &q->lock);
+    }
+    q->waiting--;
+    const bool got = q->size > 0;
+    if(got) {
+        *j = q->jobs[q->head];
+        q->head = (q->head + 1) % q->slots;
+        q->size--;
+    }
+    pthread_mutex_unlock(&q->lock);
+    return got;
+}
+
+static void queue_close(job_queue *q) {
+    pthread_mutex_lock(&q->lock);
+    q->closed = true;
+    pthread_cond_broadcast(&q->ready);
+    pthread_mutex_unlock(&q->lock);
+}
+
+// REQUESTS ////////////////////////////////////////////////
+
+static const char* status_string(int32_t status) {
+    switch(status) {
+        case PNGZD_BUSY: return "busy";
+        case PNGZD_EXPIRED: return "expired";
+        case PNGZD_BAD_REQUEST: return "bad request";
+        case PNGZD_FORBIDDEN: return "path not allowed";
+    }
+    return pngz_strerror((pngz_status)status);
+}
+
+// Sends a response without an output PNG and closes the connection.
+static void reply_status(int fd, int32_t status, double queued) {
+    printf("request refused: %s, queued %.3fs\r\n", status_string(status),
+           queued);
+    fflush(stdout);
+
+    pngzd_response response;
+    memset(&response, 0, sizeof(response));
+    memcpy(response.magic, "PZRS", 4);
+    response.status = status;
+    response.queued_seconds = queued;
+    write_full(fd, &response, sizeof(response));
+    close(fd);
+}
+
+// Whether the daemon may open path for a client: only files under
+// --path-root, once symbolic links and .. are resolved. resolved receives
+// the path to open.
+static bool path_allowed(const char *path, char resolved[PATH_MAX]) {
+    const char *root = daemon_opts->path_root;
+    if(!root || !realpath(path, resolved)) {
+        return false;
+    }
+    const size_t length = strlen(root);
+    return !strncmp(resolved, root, length) &&
+           (resolved[length] == '/' || (length == 1 && root[0] == '/'));
+}
+
+// Reads a file named in a request. Only regular files up to --max-input are
+// read, and from the descriptor that was checked: a FIFO or device could
+// block a worker, and the path may change under it after the check.
+// O_NONBLOCK keeps opening a FIFO from waiting for a writer.
+static uint8_t* read_path(const char *path, size_t *size) {
+    const int fd = open(path, O_RDONLY | O_NOFOLLOW | O_NONBLOCK);
+    if(fd < 0) {
+        return NULL;
+    }
+    struct stat st;
+    uint8_t *data = NULL;
+    if(fstat(fd, &st) == 0 && S_ISREG(st.st_mode) &&
+       (uint64_t)st.st_size <= daemon_opts->max_input) {
+        *size = st.st_size;
+        data = malloc(*size ? *size : 1);
+        if(data && !read_full(fd, data, *size)) {
+            free(data);
+            data = NULL;
+        }
+    }
+    close(fd);
+    return data;
+}
+
+// read_full with a deadline on the whole read rather than on each read, so
+// a client trickling bytes in can't stretch it out.
+static bool read_by(int fd, void *data, size_t size, double deadline) {
+    uint8_t *p = data;
+    while(size > 0) {
+        const double left = deadline - now();
+        if(left <= 0) {
+            return false;
+        }
+        struct pollfd pfd = {fd, POLLIN, 0};
+        const int ready = poll(&pfd, 1, (int)(left * 1000) + 1);
+        if(ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if(ready <= 0) {
+            return false;
+        }
+        ssize_t n = read(fd, p, size);
+        if(n < 0 && errno == EINTR) {
+            continue;
+        }
+        if(n <= 0) {
+            return false;
+        }
+        p += n;
+        size -= n;
+    }
+    return true;
+}
+
+// Reads the connection's request and payload. Returns the payload, with a
+// spare byte that terminates paths, or NULL if the request is malformed or
+// doesn't arrive in time.
+static uint8_t* receive(int fd, pngzd_request *request) {
+    const double deadline = now() + RECEIVE_TIMEOUT;
+    if(!read_by(fd, request, sizeof(*request), deadline) ||
+       memcmp(request->magic, "PZRQ", 4) ||
+       request->version != PNGZD_VERSION ||
+       request->payload_size > daemon_opts->max_input) {
+        return NULL;
+    }
+    uint8_t *payload = malloc(request->payload_size + 1);
+    if(!payload || !read_by(fd, payload, request->payload_size, deadline)) {
+        free(payload);
+        return NULL;
+    }
+    payload[request->payload_size] = '\0';
+    return payload;
+}
+
+static void process(const job *j, const pngzd_request *request,
+                    const uint8_t *payload) {
+    const double start = now();
+    const double queued = start - j->arrival;
+
+    if(request->deadline > 0 && queued >= request->deadline) {
+        reply_status(j->fd, PNGZD_EXPIRED, queued);
+        return;
+    }
+
+    const uint8_t *input = payload;
+    size_t input_size = request->payload_size;
+    uint8_t *from_path = NULL;
+    if(request->flags & PNGZD_PATH) {
+        char resolved[PATH_MAX];
+        if(!path_allowed((const char *)payload, resolved)) {
+            reply_status(j->fd, PNGZD_FORBIDDEN, queued);
+            return;
+        }
+        from_path = read_path(resolved, &input_size);
+        if(!from_path) {
+            reply_status(j->fd, PNGZD_BAD_REQUEST, queued);
+            return;
+        }
+        input = from_path;
+    }
+
+    pngz_params params;
+    pngz_stats stats;
+    pngz_params_init(&params);
+    params.cache_dir = daemon_opts->cache_dir;
+    params.trace_filename = daemon_opts->trace_filename;
+    params.name = request->flags & PNGZD_PATH ? (const char *)payload :
+                                                "(socket)";
+    params.force = request->flags & PNGZD_FORCE;
+    params.effort = request->effort;
+    params.stats = &stats;
+    // The search gets what is left of the deadline after queueing.
+    params.time_budget = request->time_budget;
+    if(request->deadline > 0) {
+        const double left = request->deadline - queued;
+        if(params.time_budget == 0 || left < params.time_budget) {
+            params.time_budget = left;
+        }
+    }
+
+    void *out = NULL;
+    size_t out_size = 0;
+    const pngz_status status = pngz_optimize(input, input_size, &out,
+                                             &out_size, &params);
+    free(from_path);
+    if(status != PNGZ_OK) {
+        reply_status(j->fd, status, queued);
+        return;
+    }
+
+    pngzd_response response;
+    memset(&response, 0, sizeof(response));
+    memcpy(response.magic, "PZRS", 4);
+    response.status = PNGZ_OK;
+    response.flags = (stats.improved ? PNGZD_IMPROVED : 0) |
+                     (stats.cache_hit ? PNGZD_CACHE_HIT : 0) |
+                     (stats.passed_through ? PNGZD_PASSED_THROUGH : 0) |
+                     (stats.deadline_reached ? PNGZD_DEADLINE_REACHED : 0) |
+                     (stats.memory_reduced ? PNGZD_MEMORY_REDUCED : 0);
+    response.original_size = stats.original_size;
+    response.queued_seconds = queued;
+    response.seconds = now() - start;
+    response.payload_size = out_size;
+    if(write_full(j->fd, &response, sizeof(response))) {
+        write_full(j->fd, out, out_size);
+    }
+    close(j->fd);
+    pngz_free(out);
+
+    printf("%s: %zu -> %zu bytes, queued %.3fs, %.3fs\r\n", params.name,
+           stats.original_size, out_size, queued, response.seconds);
+    fflush(stdout);
+}
+
+static void* worker(void *arg) {
+    job_queue *q = arg;
+    job j;
+    while(queue_pop(q, &j)) {
+        pngzd_request request;
+        uint8_t *payload = receive(j.fd, &request);
+        if(payload) {
+            process(&j, &request, payload);
+            free(payload);
+        }
+        else {
+            reply_status(j.fd, PNGZD_BAD_REQUEST, now() - j.arrival);
+        }
+    }
+    return NULL;
+}
+
+// MAIN ////////////////////////////////////////////////
+
+static void on_signal(int sig) {
+    (void)sig;
+    stopping = 1;
+}
+
+static void parse_opts(daemon_options *options, int argc, char *argv[]) {
+    int i;
+    const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    options->socket_path = PNGZD_DEFAULT_SOCKET;
+    options->workers = cores > 0 ? (int)cores : 1;
+    options->queue_size = 0;
+    options->max_input = 256;
+    options->cache_dir = NULL;
+    options->trace_filename = NULL;
+    options->path_root = NULL;
+
+    for(i=1;i<argc;i++) {
+        if(!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) {
+            printf("%s\n", msg_help);
+            exit(0);
+        }
+        else if(!strcmp(argv[i], "--socket") && i+1 < argc) {
+            options->socket_path = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--workers") && i+1 < argc) {
+            options->workers = atoi(argv[++i]);
+        }
+        else if(!strcmp(argv[i], "--queue") && i+1 < argc) {
+            options->queue_size = strtoul(argv[++i], NULL, 10);
+        }
+        else if(!strcmp(argv[i], "--max-input") && i+1 < argc) {
+            options->max_input = strtoull(argv[++i], NULL, 10);
+        }
+        else if(!strcmp(argv[i], "--memory") && i+1 < argc) {
+            pngz_set_memory_budget(strtoull(argv[++i], NULL, 10) << 20);
+        }
+        else if(!strcmp(argv[i], "--cache") && i+1 < argc) {
+            options->cache_dir = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--trace") && i+1 < argc) {
+            options->trace_filename = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--path-root") && i+1 < argc) {
+            options->path_root = realpath(argv[++i], NULL);
+            if(!options->path_root) {
+                printf("Could not resolve '%s'\r\n", argv[i]);
+                exit(1);
+            }
+        }
+        else {
+            printf("%s\n", msg_help);
+            exit(1);
+        }
+    }
+    if(options->workers < 1) {
+        options->workers = 1;
+    }
+    if(options->queue_size == 0) {
+        options->queue_size = 4 * options->workers;
+    }
+    options->max_input <<= 20;
+    // The cache never creates its directory and fails silently without it.
+    struct stat st;
+    if(options->cache_dir &&
+       (stat(options->cache_dir, &st) != 0 || !S_ISDIR(st.st_mode))) {
+        printf("Cache directory '%s' does not exist, nothing will be "
+               "cached\r\n", options->cache_dir);
+    }
+}
+
+static int listen_on(const char *path) {
+    struct sockaddr_un addr;
+    if(strlen(path) >= sizeof(addr.sun_path)) {
+        printf("Socket path '%s' is too long\r\n", path);
+        exit(1);
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+
+    // Only the daemon's own user may connect: requests run under its
+    // credentials.
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(path); // A stale socket from an earlier run
+    const mode_t mask = umask(0077);
+    const int bound = fd < 0 ? -1 :
+                      bind(fd, (struct sockaddr *)&addr, sizeof(addr));
+    umask(mask);
+    if(bound != 0 || listen(fd, 64) != 0) {
+        printf("Could not listen on '%s': %s\r\n", path, strerror(errno));
+        exit(1);
+    }
+    return fd;
+}
+
+int main(int argc, char *argv[]) {
+    daemon_options options;
+    parse_opts(&options, argc, argv);
+    daemon_opts = &options;
+
+    // Clients that hang up early must not take the daemon with them, and
+    // INT and TERM have to interrupt accept to shut down.
+    signal(SIGPIPE, SIG_IGN);
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = on_signal;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    const int listen_fd = listen_on(options.socket_path);
+
+    job_queue queue;
+    queue_init(&queue, options.queue_size, options.workers);
+    pthread_t *threads = malloc(sizeof(pthread_t) * options.workers);
+    // Workers inherit a mask without INT and TERM so the signals always
+    // reach this thread's accept.
+    sigset_t signals, previous;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, &previous);
+    int i;
+    for(i=0;i<options.workers;i++) {
+        pthread_create(&threads[i], NULL, worker, &queue);
+    }
+    pthread_sigmask(SIG_SETMASK, &previous, NULL);
+    printf("pngzd listening on %s with %d workers, queue of %zu\r\n",
+           options.socket_path, options.workers, options.queue_size);
+    fflush(stdout);
+
+    while(!stopping) {
+        const int fd = accept(listen_fd, NULL, NULL);
+        if(fd < 0) {
+            continue; // EINTR on shutdown, or a connection that went away
+        }
+        const job j = {fd, now()};
+        if(!queue_push(&queue, &j)) {
+            reply_status(fd, PNGZD_BUSY, 0);
+        }
+    }
+
+    // Finish what was accepted, then go.
+    close(listen_fd);
+    unlink(options.socket_path);
+    queue_close(&queue);
+    for(i=0;i<options.workers;i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    free(queue.jobs);
+    free(options.path_root);
+    printf("pngzd stopped\r\n");
+    return 0;
+}
@@ -0,0 +1,37 @@
+#include "protocol.h"
+
+#include <errno.h>
+#include <unistd.h>
+
+// Reads exactly size bytes, returning false on error or end of stream.
+bool read_full(int fd, void *data, size_t size) {
+    uint8_t *p = data;
+    while(size > 0) {
+        ssize_t n = read(fd, p, size);
+        if(n < 0 && errno == EINTR) {
+            continue;
+        }
+        if(n <= 0) {
+            return false;
+        }
+        p += n;
+        size -= n;
+    }
+    return true;
+}
+
+bool write_full(int fd, const void *data, size_t size) {
+    const uint8_t *p = data;
+    while(size > 0) {
+        ssize_t n = write(fd, p, size);
+        if(n < 0 && errno == EINTR) {
+            continue;
+        }
+        if(n <= 0) {
+            return false;
+        }
+        p += n;
+        size -= n;
+    }
+    return true;
+}
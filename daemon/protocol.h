@@ -0,0 +1,60 @@
+#ifndef PNGZD_PROTOCOL_H_
+#define PNGZD_PROTOCOL_H_
+
+// Wire format between pngzd and its clients over a Unix domain socket. A
+// client connects, sends one request header followed by its payload, and
+// reads one response header followed by its payload. Both ends are on the
+// same machine, so fields are in host byte order.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define PNGZD_VERSION 1
+#define PNGZD_DEFAULT_SOCKET "/tmp/pngzd.sock"
+
+// Request flags
+#define PNGZD_FORCE 1  // Search even if the input looks optimized
+#define PNGZD_PATH 2   // The payload is the path of a file to read, not a PNG.
+                       // Only served by a daemon given --path-root.
+
+// Response statuses besides the pngz_status codes
+#define PNGZD_BUSY 100         // The queue is full, try again later
+#define PNGZD_EXPIRED 101      // The deadline passed while queued
+#define PNGZD_BAD_REQUEST 102  // Malformed request or unreadable path
+#define PNGZD_FORBIDDEN 103    // Path requests are off, or the path is outside
+                               // the daemon's --path-root
+
+// Response flags
+#define PNGZD_IMPROVED 1
+#define PNGZD_CACHE_HIT 2
+#define PNGZD_PASSED_THROUGH 4
+#define PNGZD_DEADLINE_REACHED 8
+#define PNGZD_MEMORY_REDUCED 16
+
+typedef struct pngzd_request_s {
+    char magic[4];          // "PZRQ"
+    uint32_t version;
+    uint32_t flags;
+    uint32_t effort;        // pngz -o level
+    double time_budget;     // Seconds of search, 0 for none
+    double deadline;        // Seconds from arrival to answer, queueing
+                            // included, 0 for none
+    uint64_t payload_size;
+} pngzd_request;
+
+typedef struct pngzd_response_s {
+    char magic[4];          // "PZRS"
+    int32_t status;         // pngz_status or one of the PNGZD_ statuses
+    uint32_t flags;
+    uint32_t reserved;
+    uint64_t original_size;
+    double queued_seconds;
+    double seconds;         // Spent optimizing
+    uint64_t payload_size;  // The output PNG, if status is 0
+} pngzd_response;
+
+bool read_full(int fd, void *data, size_t size);
+bool write_full(int fd, const void *data, size_t size);
+
+#endif
@@ -0,0 +1,283 @@
+/*
+Micro-benchmark for ZopfliLengthLimitedCodeLengths. Times it against the
+original malloc and qsort based package-merge, kept below as the reference, on
+histograms shaped like the ones deflate produces, and checks that both give
+codes of equal cost.
+
+Build and run with "make bench" in the zopfli directory.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../src/zopfli/katajainen.h"
+
+typedef struct Node Node;
+
+struct Node {
+  size_t weight;
+  Node* tail;
+  int count;
+  char inuse;
+};
+
+typedef struct NodePool {
+  Node* nodes;
+  Node* next;
+  int size;
+} NodePool;
+
+static void InitNode(size_t weight, int count, Node* tail, Node* node) {
+  node->weight = weight;
+  node->count = count;
+  node->tail = tail;
+  node->inuse = 1;
+}
+
+static Node* GetFreeNode(Node* (*lists)[2], int maxbits, NodePool* pool) {
+  for (;;) {
+    if (pool->next >= &pool->nodes[pool->size]) {
+      int i;
+      for (i = 0; i < pool->size; i++) {
+        pool->nodes[i].inuse = 0;
+      }
+      if (lists) {
+        for (i = 0; i < maxbits * 2; i++) {
+          Node* node;
+          for (node = lists[i / 2][i % 2]; node; node = node->tail) {
+            node->inuse = 1;
+          }
+        }
+      }
+      pool->next = &pool->nodes[0];
+    }
+    if (!pool->next->inuse) break;
+    pool->next++;
+  }
+  return pool->next++;
+}
+
+static void BoundaryPM(Node* (*lists)[2], int maxbits,
+    Node* leaves, int numsymbols, NodePool* pool, int index, char final) {
+  Node* newchain;
+  Node* oldchain;
+  int lastcount = lists[index][1]->count;
+
+  if (index == 0 && lastcount >= numsymbols) return;
+
+  newchain = GetFreeNode(lists, maxbits, pool);
+  oldchain = lists[index][1];
+
+  lists[index][0] = oldchain;
+  lists[index][1] = newchain;
+
+  if (index == 0) {
+    InitNode(leaves[lastcount].weight, lastcount + 1, 0, newchain);
+  } else {
+    size_t sum = lists[index - 1][0]->weight + lists[index - 1][1]->weight;
+    if (lastcount < numsymbols && sum > leaves[lastcount].weight) {
+      InitNode(leaves[lastcount].weight, lastcount + 1, oldchain->tail,
+          newchain);
+    } else {
+      InitNode(sum, lastcount, lists[index - 1][1], newchain);
+      if (!final) {
+        BoundaryPM(lists, maxbits, leaves, numsymbols, pool, index - 1, 0);
+        BoundaryPM(lists, maxbits, leaves, numsymbols, pool, index - 1, 0);
+      }
+    }
+  }
+}
+
+static void InitLists(
+    NodePool* pool, const Node* leaves, int maxbits, Node* (*lists)[2]) {
+  int i;
+  Node* node0 = GetFreeNode(0, maxbits, pool);
+  Node* node1 = GetFreeNode(0, maxbits, pool);
+  InitNode(leaves[0].weight, 1, 0, node0);
+  InitNode(leaves[1].weight, 2, 0, node1);
+  for (i = 0; i < maxbits; i++) {
+    lists[i][0] = node0;
+    lists[i][1] = node1;
+  }
+}
+
+static void ExtractBitLengths(Node* chain, Node* leaves, unsigned* bitlengths) {
+  Node* node;
+  for (node = chain; node; node = node->tail) {
+    int i;
+    for (i = 0; i < node->count; i++) {
+      bitlengths[leaves[i].count]++;
+    }
+  }
+}
+
+static int LeafComparator(const void* a, const void* b) {
+  return ((const Node*)a)->weight - ((const Node*)b)->weight;
+}
+
+/*
+The package-merge as it was before the workspace, sort and Huffman shortcut
+changes.
+*/
+static int ReferenceLengthLimitedCodeLengths(
+    const size_t* frequencies, int n, int maxbits, unsigned* bitlengths) {
+  NodePool pool;
+  int i;
+  int numsymbols = 0;
+  int numBoundaryPMRuns;
+  Node* (*lists)[2];
+  Node* leaves = (Node*)malloc(n * sizeof(*leaves));
+
+  for (i = 0; i < n; i++) {
+    bitlengths[i] = 0;
+  }
+  for (i = 0; i < n; i++) {
+    if (frequencies[i]) {
+      leaves[numsymbols].weight = frequencies[i];
+      leaves[numsymbols].count = i;
+      numsymbols++;
+    }
+  }
+
+  if ((1 << maxbits) < numsymbols) {
+    free(leaves);
+    return 1;
+  }
+  if (numsymbols == 0) {
+    free(leaves);
+    return 0;
+  }
+  if (numsymbols == 1) {
+    bitlengths[leaves[0].count] = 1;
+    free(leaves);
+    return 0;
+  }
+
+  qsort(leaves, numsymbols, sizeof(Node), LeafComparator);
+
+  pool.size = 2 * maxbits * (maxbits + 1);
+  pool.nodes = (Node*)malloc(pool.size * sizeof(*pool.nodes));
+  pool.next = pool.nodes;
+  for (i = 0; i < pool.size; i++) {
+    pool.nodes[i].inuse = 0;
+  }
+
+  lists = (Node* (*)[2])malloc(maxbits * sizeof(*lists));
+  InitLists(&pool, leaves, maxbits, lists);
+
+  numBoundaryPMRuns = 2 * numsymbols - 4;
+  for (i = 0; i < numBoundaryPMRuns; i++) {
+    char final = i == numBoundaryPMRuns - 1;
+    BoundaryPM(lists, maxbits, leaves, numsymbols, &pool, maxbits - 1, final);
+  }
+
+  ExtractBitLengths(lists[maxbits - 1][1], leaves, bitlengths);
+
+  free(lists);
+  free(leaves);
+  free(pool.nodes);
+  return 0;
+}
+
+#define NUM_HISTOGRAMS 4096
+#define MAX_SYMBOLS 288
+
+typedef struct Histogram {
+  size_t counts[MAX_SYMBOLS];
+  int n;
+  int maxbits;
+} Histogram;
+
+typedef int LengthsFunction(const size_t*, int, int, unsigned*);
+
+/*
+Deterministic pseudo random numbers, so every run measures the same input.
+*/
+static unsigned long NextRandom(unsigned long* state) {
+  *state = (*state * 1103515245UL + 12345UL) & 0xffffffffUL;
+  return *state >> 8;
+}
+
+/*
+Fills in a histogram shaped like the deflate ones: the alphabet sizes and
+length limits of the literal/length, distance and code length codes, skewed
+counts, some unused symbols and sometimes a very long tail that makes the
+length limit matter.
+*/
+static void MakeHistogram(unsigned long* state, Histogram* h) {
+  static const int sizes[3] = {288, 32, 19};
+  static const int limits[3] = {15, 15, 7};
+  int kind = NextRandom(state) % 3;
+  unsigned long scale = 1 + NextRandom(state) % 100000;
+  int skewed = NextRandom(state) % 4 == 0;
+  int i;
+  h->n = sizes[kind];
+  h->maxbits = limits[kind];
+  for (i = 0; i < h->n; i++) {
+    unsigned long r = NextRandom(state);
+    if (r % 5 == 0) {
+      h->counts[i] = 0;
+    } else if (skewed) {
+      h->counts[i] = 1 + (scale >> (r % 24));
+    } else {
+      h->counts[i] = 1 + r % (scale / (1 + i % 16) + 1);
+    }
+  }
+}
+
+static size_t Cost(const Histogram* h, const unsigned* bitlengths) {
+  size_t cost = 0;
+  int i;
+  for (i = 0; i < h->n; i++) cost += h->counts[i] * bitlengths[i];
+  return cost;
+}
+
+static double Run(LengthsFunction* f, const Histogram* hs, int rounds) {
+  unsigned bitlengths[MAX_SYMBOLS];
+  clock_t start = clock();
+  int r, i;
+  for (r = 0; r < rounds; r++) {
+    for (i = 0; i < NUM_HISTOGRAMS; i++) {
+      f(hs[i].counts, hs[i].n, hs[i].maxbits, bitlengths);
+    }
+  }
+  return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char* argv[]) {
+  int rounds = argc > 1 ? atoi(argv[1]) : 10;
+  unsigned long state = 1;
+  Histogram* hs = (Histogram*)malloc(NUM_HISTOGRAMS * sizeof(*hs));
+  double reference, current;
+  int i;
+
+  for (i = 0; i < NUM_HISTOGRAMS; i++) {
+    unsigned a[MAX_SYMBOLS], b[MAX_SYMBOLS];
+    int j;
+    unsigned long kraft = 0;
+    MakeHistogram(&state, &hs[i]);
+    ReferenceLengthLimitedCodeLengths(hs[i].counts, hs[i].n, hs[i].maxbits, a);
+    ZopfliLengthLimitedCodeLengths(hs[i].counts, hs[i].n, hs[i].maxbits, b);
+    for (j = 0; j < hs[i].n; j++) {
+      if (b[j] > (unsigned)hs[i].maxbits || (!b[j]) != (!hs[i].counts[j])) {
+        printf("histogram %d: invalid length for symbol %d\n", i, j);
+        return 1;
+      }
+      if (b[j]) kraft += 1UL << (15 - b[j]);
+    }
+    if (kraft > 1UL << 15 || Cost(&hs[i], a) != Cost(&hs[i], b)) {
+      printf("histogram %d: code differs in cost from the reference\n", i);
+      return 1;
+    }
+  }
+
+  reference = Run(ReferenceLengthLimitedCodeLengths, hs, rounds);
+  current = Run(ZopfliLengthLimitedCodeLengths, hs, rounds);
+  printf("%d histograms x %d rounds\n", NUM_HISTOGRAMS, rounds);
+  printf("reference: %.3fs\n", reference);
+  printf("current:   %.3fs (%.2fx)\n", current, reference / current);
+
+  free(hs);
+  return 0;
+}
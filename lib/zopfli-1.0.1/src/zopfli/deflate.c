@@ -29,46 +29,135 @@ Author: jyrki.alakuijala@gmail.com (Jyrki Alakuijala)
 #include "tree.h"
 
 /*
-bp = bitpointer, always in range [0, 7].
-The outsize is number of necessary bytes to encode the bits.
-Given the value of bp and the amount of bytes, the amount of bits represented
-is not simply bytesize * 8 + bp because even representing one bit requires a
-whole byte. It is: (bp == 0) ? (bytesize * 8) : ((bytesize - 1) * 8 + bp)
+Bit writer for the deflate output. Bits are gathered in a word sized
+accumulator and stored a whole word at a time. The output buffer is only ever
+grown to a power of two, so that once the writer is finished it can be handed
+back as a dynamic array that ZOPFLI_APPEND_DATA can keep appending to.
 */
-static void AddBit(int bit,
-                   unsigned char* bp, unsigned char** out, size_t* outsize) {
-  if (*bp == 0) ZOPFLI_APPEND_DATA(0, out, outsize);
-  (*out)[*outsize - 1] |= bit << *bp;
-  *bp = (*bp + 1) & 7;
+typedef struct BitWriter {
+  size_t bits;  /* Pending bits, the first one in the least significant bit. */
+  unsigned nbits;  /* Amount of pending bits, always less than a word. */
+  unsigned char* data;  /* Output bytes, not including the pending bits. */
+  size_t size;  /* Amount of bytes in data. */
+  size_t allocsize;  /* Allocated size of data: 0 or a power of two. */
+} BitWriter;
+
+#define ZOPFLI_WORD_BITS (sizeof(size_t) * 8)
+
+/*
+Makes sure at least n more bytes can be stored without reallocating.
+*/
+static void BitWriterReserve(BitWriter* w, size_t n) {
+  size_t needed = w->size + n;
+  size_t allocsize = w->allocsize == 0 ? 1 : w->allocsize;
+  if (needed <= w->allocsize) return;
+  while (allocsize < needed) allocsize <<= 1;
+  w->data = (unsigned char*)realloc(w->data, allocsize);
+  if (!w->data) exit(-1); /* Allocation failed. */
+  w->allocsize = allocsize;
+}
+
+/*
+Takes over the dynamic output array and bit pointer, as used by the public
+functions. A partially filled last byte becomes the start of the accumulator.
+*/
+static void BitWriterInit(unsigned char bp, unsigned char* out, size_t outsize,
+                          BitWriter* w) {
+  w->bits = 0;
+  w->nbits = 0;
+  w->data = out;
+  w->size = outsize;
+  /* ZOPFLI_APPEND_DATA guarantees at least the next power of two. */
+  w->allocsize = 0;
+  if (outsize > 0) {
+    w->allocsize = 1;
+    while (w->allocsize < outsize) w->allocsize <<= 1;
+  }
+  if (bp != 0) {
+    w->size--;
+    w->bits = w->data[w->size];
+    w->nbits = bp;
+  }
+}
+
+/*
+Stores all pending whole bytes, and the partial last byte if any, and hands the
+output back as dynamic array and bit pointer.
+*/
+static void BitWriterFinish(BitWriter* w, unsigned char* bp,
+                            unsigned char** out, size_t* outsize) {
+  *bp = w->nbits & 7;
+  BitWriterReserve(w, (w->nbits + 7) / 8);
+  while (w->nbits > 0) {
+    w->data[w->size++] = (unsigned char)(w->bits & 255);
+    w->bits >>= 8;
+    w->nbits = w->nbits > 8 ? w->nbits - 8 : 0;
+  }
+  *out = w->data;
+  *outsize = w->size;
+}
+
+/* Amount of bytes needed for everything written so far. */
+static size_t BitWriterSize(const BitWriter* w) {
+  return w->size + (w->nbits + 7) / 8;
+}
+
+/* Stores the full accumulator, least significant byte first. */
+static void BitWriterStoreWord(BitWriter* w, size_t bits) {
+  size_t i;
+  BitWriterReserve(w, sizeof(size_t));
+  for (i = 0; i < sizeof(size_t); i++) {
+    w->data[w->size + i] = (unsigned char)(bits >> (i * 8));
+  }
+  w->size += sizeof(size_t);
 }
 
-static void AddBits(unsigned symbol, unsigned length,
-                    unsigned char* bp, unsigned char** out, size_t* outsize) {
-  /* TODO(lode): make more efficient (add more bits at once). */
+/*
+Pads the pending bits with zeroes up to a byte boundary and stores them, as
+needed before the bytes of a non compressed block.
+*/
+static void BitWriterAlignToByte(BitWriter* w) {
+  w->nbits = (w->nbits + 7) & ~7u;
+  BitWriterReserve(w, w->nbits / 8);
+  while (w->nbits > 0) {
+    w->data[w->size++] = (unsigned char)(w->bits & 255);
+    w->bits = w->nbits > 8 ? w->bits >> 8 : 0;
+    w->nbits -= 8;
+  }
+}
+
+static void AddBits(unsigned symbol, unsigned length, BitWriter* w) {
+  symbol &= (1u << length) - 1;
+  w->bits |= (size_t)symbol << w->nbits;
+  w->nbits += length;
+  if (w->nbits >= ZOPFLI_WORD_BITS) {
+    BitWriterStoreWord(w, w->bits);
+    w->nbits -= ZOPFLI_WORD_BITS;
+    /* The bits of symbol that did not fit in the stored word. */
+    w->bits = w->nbits == 0 ? 0 : (size_t)symbol >> (length - w->nbits);
+  }
+}
+
+static void AddBit(int bit, BitWriter* w) {
+  AddBits(bit, 1, w);
+}
+
+/* Reverses the order of the length lowest bits of symbol. */
+static unsigned ReverseBits(unsigned symbol, unsigned length) {
+  unsigned result = 0;
   unsigned i;
   for (i = 0; i < length; i++) {
-    unsigned bit = (symbol >> i) & 1;
-    if (*bp == 0) ZOPFLI_APPEND_DATA(0, out, outsize);
-    (*out)[*outsize - 1] |= bit << *bp;
-    *bp = (*bp + 1) & 7;
+    result = (result << 1) | ((symbol >> i) & 1);
   }
+  return result;
 }
 
 /*
 Adds bits, like AddBits, but the order is inverted. The deflate specification
 uses both orders in one standard.
 */
-static void AddHuffmanBits(unsigned symbol, unsigned length,
-                           unsigned char* bp, unsigned char** out,
-                           size_t* outsize) {
-  /* TODO(lode): make more efficient (add more bits at once). */
-  unsigned i;
-  for (i = 0; i < length; i++) {
-    unsigned bit = (symbol >> (length - i - 1)) & 1;
-    if (*bp == 0) ZOPFLI_APPEND_DATA(0, out, outsize);
-    (*out)[*outsize - 1] |= bit << *bp;
-    *bp = (*bp + 1) & 7;
-  }
+static void AddHuffmanBits(unsigned symbol, unsigned length, BitWriter* w) {
+  AddBits(ReverseBits(symbol, length), length, w);
 }
 
 /*
@@ -99,14 +188,13 @@ static void PatchDistanceCodesForBuggyDecoders(unsigned* d_lengths) {
 }
 
 /*
-Encodes the Huffman tree and returns how many bits its encoding takes. If out
+Encodes the Huffman tree and returns how many bits its encoding takes. If w
 is a null pointer, only returns the size and runs faster.
 */
 static size_t EncodeTree(const unsigned* ll_lengths,
                          const unsigned* d_lengths,
                          int use_16, int use_17, int use_18,
-                         unsigned char* bp,
-                         unsigned char** out, size_t* outsize) {
+                         BitWriter* w) {
   unsigned lld_total;  /* Total amount of literal, length, distance codes. */
   /* Runlength encoded version of lengths of litlen and dist trees. */
   unsigned* rle = 0;
@@ -125,7 +213,7 @@ static size_t EncodeTree(const unsigned* ll_lengths,
   static const unsigned order[19] = {
     16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
   };
-  int size_only = !out;
+  int size_only = !w;
   size_t result_size = 0;
 
   for(i = 0; i < 19; i++) clcounts[i] = 0;
@@ -213,21 +301,21 @@ static size_t EncodeTree(const unsigned* ll_lengths,
   while (hclen > 0 && clcounts[order[hclen + 4 - 1]] == 0) hclen--;
 
   if (!size_only) {
-    AddBits(hlit, 5, bp, out, outsize);
-    AddBits(hdist, 5, bp, out, outsize);
-    AddBits(hclen, 4, bp, out, outsize);
+    AddBits(hlit, 5, w);
+    AddBits(hdist, 5, w);
+    AddBits(hclen, 4, w);
 
     for (i = 0; i < hclen + 4; i++) {
-      AddBits(clcl[order[i]], 3, bp, out, outsize);
+      AddBits(clcl[order[i]], 3, w);
     }
 
     for (i = 0; i < rle_size; i++) {
       unsigned symbol = clsymbols[rle[i]];
-      AddHuffmanBits(symbol, clcl[rle[i]], bp, out, outsize);
+      AddHuffmanBits(symbol, clcl[rle[i]], w);
       /* Extra bits. */
-      if (rle[i] == 16) AddBits(rle_bits[i], 2, bp, out, outsize);
-      else if (rle[i] == 17) AddBits(rle_bits[i], 3, bp, out, outsize);
-      else if (rle[i] == 18) AddBits(rle_bits[i], 7, bp, out, outsize);
+      if (rle[i] == 16) AddBits(rle_bits[i], 2, w);
+      else if (rle[i] == 17) AddBits(rle_bits[i], 3, w);
+      else if (rle[i] == 18) AddBits(rle_bits[i], 7, w);
     }
   }
 
@@ -250,25 +338,23 @@ static size_t EncodeTree(const unsigned* ll_lengths,
 
 static void AddDynamicTree(const unsigned* ll_lengths,
                            const unsigned* d_lengths,
-                           unsigned char* bp,
-                           unsigned char** out, size_t* outsize) {
+                           BitWriter* w) {
   int i;
   int best = 0;
   size_t bestsize = 0;
 
   for(i = 0; i < 8; i++) {
     size_t size = EncodeTree(ll_lengths, d_lengths,
-                             i & 1, i & 2, i & 4,
-                             0, 0, 0);
+                             i & 1, i & 2, i & 4, 0);
     if (bestsize == 0 || size < bestsize) {
       bestsize = size;
       best = i;
     }
   }
 
+  BitWriterReserve(w, bestsize / 8 + sizeof(size_t));
   EncodeTree(ll_lengths, d_lengths,
-             best & 1, best & 2, best & 4,
-             bp, out, outsize);
+             best & 1, best & 2, best & 4, w);
 }
 
 /*
@@ -281,8 +367,7 @@ static size_t CalculateTreeSize(const unsigned* ll_lengths,
 
   for(i = 0; i < 8; i++) {
     size_t size = EncodeTree(ll_lengths, d_lengths,
-                             i & 1, i & 2, i & 4,
-                             0, 0, 0);
+                             i & 1, i & 2, i & 4, 0);
     if (result == 0 || size < result) result = size;
   }
 
@@ -293,25 +378,25 @@ static size_t CalculateTreeSize(const unsigned* ll_lengths,
 Adds all lit/len and dist codes from the lists as huffman symbols. Does not add
 end code 256. expected_data_size is the uncompressed block size, used for
 assert, but you can set it to 0 to not do the assertion.
+The symbols must already be bit reversed, see ReverseSymbols, so that they can
+be written with AddBits.
 */
-static void AddLZ77Data(const unsigned short* litlens,
-                        const unsigned short* dists,
+static void AddLZ77Data(const ZopfliLZ77Store* lz77,
                         size_t lstart, size_t lend,
                         size_t expected_data_size,
                         const unsigned* ll_symbols, const unsigned* ll_lengths,
                         const unsigned* d_symbols, const unsigned* d_lengths,
-                        unsigned char* bp,
-                        unsigned char** out, size_t* outsize) {
+                        BitWriter* w) {
   size_t testlength = 0;
   size_t i;
 
   for (i = lstart; i < lend; i++) {
-    unsigned dist = dists[i];
-    unsigned litlen = litlens[i];
+    unsigned dist = lz77->entries[i].dist;
+    unsigned litlen = lz77->entries[i].litlen;
     if (dist == 0) {
       assert(litlen < 256);
       assert(ll_lengths[litlen] > 0);
-      AddHuffmanBits(ll_symbols[litlen], ll_lengths[litlen], bp, out, outsize);
+      AddBits(ll_symbols[litlen], ll_lengths[litlen], w);
       testlength++;
     } else {
       unsigned lls = ZopfliGetLengthSymbol(litlen);
@@ -319,20 +404,30 @@ static void AddLZ77Data(const unsigned short* litlens,
       assert(litlen >= 3 && litlen <= 288);
       assert(ll_lengths[lls] > 0);
       assert(d_lengths[ds] > 0);
-      AddHuffmanBits(ll_symbols[lls], ll_lengths[lls], bp, out, outsize);
+      AddBits(ll_symbols[lls], ll_lengths[lls], w);
       AddBits(ZopfliGetLengthExtraBitsValue(litlen),
-              ZopfliGetLengthExtraBits(litlen),
-              bp, out, outsize);
-      AddHuffmanBits(d_symbols[ds], d_lengths[ds], bp, out, outsize);
+              ZopfliGetLengthExtraBits(litlen), w);
+      AddBits(d_symbols[ds], d_lengths[ds], w);
       AddBits(ZopfliGetDistExtraBitsValue(dist),
-              ZopfliGetDistExtraBits(dist),
-              bp, out, outsize);
+              ZopfliGetDistExtraBits(dist), w);
       testlength += litlen;
     }
   }
   assert(expected_data_size == 0 || testlength == expected_data_size);
 }
 
+/*
+Reverses the bits of each of the n symbols, so that the huffman codes can be
+written with AddBits rather than AddHuffmanBits.
+*/
+static void ReverseSymbols(const unsigned* lengths, size_t n,
+                           unsigned* symbols) {
+  size_t i;
+  for (i = 0; i < n; i++) {
+    symbols[i] = ReverseBits(symbols[i], lengths[i]);
+  }
+}
+
 static void GetFixedTree(unsigned* ll_lengths, unsigned* d_lengths) {
   size_t i;
   for (i = 0; i < 144; i++) ll_lengths[i] = 8;
@@ -343,29 +438,81 @@ static void GetFixedTree(unsigned* ll_lengths, unsigned* d_lengths) {
 }
 
 /*
-Calculates size of the part after the header and tree of an LZ77 block, in bits.
+Calculates size of the part after the header and tree of an LZ77 block, in bits,
+by walking the LZ77 data.
 */
-static size_t CalculateBlockSymbolSize(const unsigned* ll_lengths,
-                                       const unsigned* d_lengths,
-                                       const unsigned short* litlens,
-                                       const unsigned short* dists,
-                                       size_t lstart, size_t lend) {
+static size_t CalculateBlockSymbolSizeSmall(const unsigned* ll_lengths,
+                                            const unsigned* d_lengths,
+                                            const ZopfliLZ77Store* lz77,
+                                            size_t lstart, size_t lend) {
   size_t result = 0;
   size_t i;
   for (i = lstart; i < lend; i++) {
-    if (dists[i] == 0) {
-      result += ll_lengths[litlens[i]];
+    const ZopfliLZ77Entry* entry = &lz77->entries[i];
+    if (entry->dist == 0) {
+      result += ll_lengths[entry->litlen];
     } else {
-      result += ll_lengths[ZopfliGetLengthSymbol(litlens[i])];
-      result += d_lengths[ZopfliGetDistSymbol(dists[i])];
-      result += ZopfliGetLengthExtraBits(litlens[i]);
-      result += ZopfliGetDistExtraBits(dists[i]);
+      result += ll_lengths[ZopfliGetLengthSymbol(entry->litlen)];
+      result += d_lengths[ZopfliGetDistSymbol(entry->dist)];
+      result += ZopfliGetLengthExtraBits(entry->litlen);
+      result += ZopfliGetDistExtraBits(entry->dist);
     }
   }
   result += ll_lengths[256]; /*end symbol*/
   return result;
 }
 
+/*
+Same as CalculateBlockSymbolSizeSmall, but from the symbol histograms. The extra
+bits only depend on the symbol, so the data itself is not needed.
+*/
+static size_t CalculateBlockSymbolSizeGivenCounts(const size_t* ll_counts,
+                                                  const size_t* d_counts,
+                                                  const unsigned* ll_lengths,
+                                                  const unsigned* d_lengths) {
+  /* Extra bits of length symbols 257-285 and dist symbols 0-29. */
+  static const unsigned length_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+    4, 4, 4, 4, 5, 5, 5, 5, 0
+  };
+  static const unsigned dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8,
+    9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+  };
+  size_t result = 0;
+  size_t i;
+  for (i = 0; i < 256; i++) {
+    result += ll_lengths[i] * ll_counts[i];
+  }
+  for (i = 257; i < 286; i++) {
+    result += (ll_lengths[i] + length_extra[i - 257]) * ll_counts[i];
+  }
+  for (i = 0; i < 30; i++) {
+    result += (d_lengths[i] + dist_extra[i]) * d_counts[i];
+  }
+  result += ll_lengths[256]; /*end symbol*/
+  return result;
+}
+
+/*
+Calculates size of the part after the header and tree of an LZ77 block, in bits.
+*/
+static size_t CalculateBlockSymbolSize(const unsigned* ll_lengths,
+                                       const unsigned* d_lengths,
+                                       const ZopfliLZ77Store* lz77,
+                                       size_t lstart, size_t lend) {
+  if (lstart + ZOPFLI_NUM_LL * 3 > lend) {
+    return CalculateBlockSymbolSizeSmall(
+        ll_lengths, d_lengths, lz77, lstart, lend);
+  } else {
+    size_t ll_counts[ZOPFLI_NUM_LL];
+    size_t d_counts[ZOPFLI_NUM_D];
+    ZopfliLZ77GetHistogram(lz77, lstart, lend, ll_counts, d_counts);
+    return CalculateBlockSymbolSizeGivenCounts(
+        ll_counts, d_counts, ll_lengths, d_lengths);
+  }
+}
+
 static size_t AbsDiff(size_t x, size_t y) {
   if (x > y)
     return x - y;
@@ -470,14 +617,13 @@ lengths that give the smallest size of tree encoding + encoding of all the
 symbols to have smallest output size. This are not necessarily the ideal Huffman
 bit lengths.
 */
-static void GetDynamicLengths(const unsigned short* litlens,
-                              const unsigned short* dists,
+static void GetDynamicLengths(const ZopfliLZ77Store* lz77,
                               size_t lstart, size_t lend,
                               unsigned* ll_lengths, unsigned* d_lengths) {
-  size_t ll_counts[288];
-  size_t d_counts[32];
+  size_t ll_counts[ZOPFLI_NUM_LL];
+  size_t d_counts[ZOPFLI_NUM_D];
 
-  ZopfliLZ77Counts(litlens, dists, lstart, lend, ll_counts, d_counts);
+  ZopfliLZ77GetHistogram(lz77, lstart, lend, ll_counts, d_counts);
   OptimizeHuffmanForRle(288, ll_counts);
   OptimizeHuffmanForRle(32, d_counts);
   ZopfliCalculateBitLengths(ll_counts, 288, 15, ll_lengths);
@@ -485,8 +631,7 @@ static void GetDynamicLengths(const unsigned short* litlens,
   PatchDistanceCodesForBuggyDecoders(d_lengths);
 }
 
-double ZopfliCalculateBlockSize(const unsigned short* litlens,
-                                const unsigned short* dists,
+double ZopfliCalculateBlockSize(const ZopfliLZ77Store* lz77,
                                 size_t lstart, size_t lend, int btype) {
   unsigned ll_lengths[288];
   unsigned d_lengths[32];
@@ -498,40 +643,66 @@ double ZopfliCalculateBlockSize(const unsigned short* litlens,
   if(btype == 1) {
     GetFixedTree(ll_lengths, d_lengths);
   } else {
-    GetDynamicLengths(litlens, dists, lstart, lend, ll_lengths, d_lengths);
+    GetDynamicLengths(lz77, lstart, lend, ll_lengths, d_lengths);
     result += CalculateTreeSize(ll_lengths, d_lengths);
   }
 
   result += CalculateBlockSymbolSize(
-      ll_lengths, d_lengths, litlens, dists, lstart, lend);
+      ll_lengths, d_lengths, lz77, lstart, lend);
 
   return result;
 }
 
+void ZopfliEnterPhase(const ZopfliOptions* options, const char* name) {
+  if (options->phase) options->phase(options->phase_context, name);
+}
+
+int ZopfliStopped(const ZopfliOptions* options) {
+  return options->stop && options->stop(options->stop_context);
+}
+
+#ifdef ZOPFLI_LONGEST_MATCH_CACHE
+/*
+Allocates the longest match cache for a block of the given size, or returns
+NULL, which makes the LZ77 search go without, when options cap the size of
+cached blocks below it.
+*/
+static ZopfliLongestMatchCache* NewBlockCache(const ZopfliOptions* options,
+                                              size_t blocksize) {
+  ZopfliLongestMatchCache* lmc;
+  if (options->cachemaxblocksize != 0 &&
+      blocksize > options->cachemaxblocksize) {
+    return 0;
+  }
+  lmc = (ZopfliLongestMatchCache*)malloc(sizeof(ZopfliLongestMatchCache));
+  ZopfliInitCache(blocksize, lmc);
+  return lmc;
+}
+
+static void DeleteBlockCache(ZopfliLongestMatchCache* lmc) {
+  if (!lmc) return;
+  ZopfliCleanCache(lmc);
+  free(lmc);
+}
+#endif
+
 /*
 Adds a deflate block with the given LZ77 data to the output.
 options: global program options
 btype: the block type, must be 1 or 2
 final: whether to set the "final" bit on this block, must be the last block
-litlens: literal/length array of the LZ77 data, in the same format as in
-    ZopfliLZ77Store.
-dists: distance array of the LZ77 data, in the same format as in
-    ZopfliLZ77Store.
+lz77: the LZ77 data
 lstart: where to start in the LZ77 data
 lend: where to end in the LZ77 data (not inclusive)
 expected_data_size: the uncompressed block size, used for assert, but you can
   set it to 0 to not do the assertion.
-bp: output bit pointer
-out: dynamic output array to append to
-outsize: dynamic output array size
+w: the output bit writer
 */
 static void AddLZ77Block(const ZopfliOptions* options, int btype, int final,
-                         const unsigned short* litlens,
-                         const unsigned short* dists,
+                         const ZopfliLZ77Store* lz77,
                          size_t lstart, size_t lend,
                          size_t expected_data_size,
-                         unsigned char* bp,
-                         unsigned char** out, size_t* outsize) {
+                         BitWriter* w) {
   unsigned ll_lengths[288];
   unsigned d_lengths[32];
   unsigned ll_symbols[288];
@@ -541,9 +712,9 @@ static void AddLZ77Block(const ZopfliOptions* options, int btype, int final,
   size_t uncompressed_size = 0;
   size_t i;
 
-  AddBit(final, bp, out, outsize);
-  AddBit(btype & 1, bp, out, outsize);
-  AddBit((btype & 2) >> 1, bp, out, outsize);
+  AddBit(final, w);
+  AddBit(btype & 1, w);
+  AddBit((btype & 2) >> 1, w);
 
   if (btype == 1) {
     /* Fixed block. */
@@ -553,29 +724,37 @@ static void AddLZ77Block(const ZopfliOptions* options, int btype, int final,
     unsigned detect_tree_size;
     assert(btype == 2);
 
-    GetDynamicLengths(litlens, dists, lstart, lend, ll_lengths, d_lengths);
+    GetDynamicLengths(lz77, lstart, lend, ll_lengths, d_lengths);
 
-    detect_tree_size = *outsize;
-    AddDynamicTree(ll_lengths, d_lengths, bp, out, outsize);
+    detect_tree_size = BitWriterSize(w);
+    AddDynamicTree(ll_lengths, d_lengths, w);
     if (options->verbose) {
-      fprintf(stderr, "treesize: %d\n", (int)(*outsize - detect_tree_size));
+      fprintf(stderr, "treesize: %d\n",
+              (int)(BitWriterSize(w) - detect_tree_size));
     }
   }
 
   ZopfliLengthsToSymbols(ll_lengths, 288, 15, ll_symbols);
   ZopfliLengthsToSymbols(d_lengths, 32, 15, d_symbols);
+  ReverseSymbols(ll_lengths, 288, ll_symbols);
+  ReverseSymbols(d_lengths, 32, d_symbols);
 
-  detect_block_size = *outsize;
-  AddLZ77Data(litlens, dists, lstart, lend, expected_data_size,
-              ll_symbols, ll_lengths, d_symbols, d_lengths,
-              bp, out, outsize);
+  /* The exact size of the symbols is known, so the output only has to grow
+  once for the whole block. */
+  BitWriterReserve(w, CalculateBlockSymbolSize(
+      ll_lengths, d_lengths, lz77, lstart, lend) / 8 + sizeof(size_t));
+
+  detect_block_size = BitWriterSize(w);
+  AddLZ77Data(lz77, lstart, lend, expected_data_size,
+              ll_symbols, ll_lengths, d_symbols, d_lengths, w);
   /* End symbol. */
-  AddHuffmanBits(ll_symbols[256], ll_lengths[256], bp, out, outsize);
+  AddBits(ll_symbols[256], ll_lengths[256], w);
 
   for (i = lstart; i < lend; i++) {
-    uncompressed_size += dists[i] == 0 ? 1 : litlens[i];
+    const ZopfliLZ77Entry* entry = &lz77->entries[i];
+    uncompressed_size += entry->dist == 0 ? 1 : entry->litlen;
   }
-  compressed_size = *outsize - detect_block_size;
+  compressed_size = BitWriterSize(w) - detect_block_size;
   if (options->verbose) {
     fprintf(stderr, "compressed block size: %d (%dk) (unc: %d)\n",
            (int)compressed_size, (int)(compressed_size / 1024),
@@ -586,8 +765,7 @@ static void AddLZ77Block(const ZopfliOptions* options, int btype, int final,
 static void DeflateDynamicBlock(const ZopfliOptions* options, int final,
                                 const unsigned char* in,
                                 size_t instart, size_t inend,
-                                unsigned char* bp,
-                                unsigned char** out, size_t* outsize) {
+                                BitWriter* w) {
   ZopfliBlockState s;
   size_t blocksize = inend - instart;
   ZopfliLZ77Store store;
@@ -599,8 +777,7 @@ static void DeflateDynamicBlock(const ZopfliOptions* options, int final,
   s.blockstart = instart;
   s.blockend = inend;
 #ifdef ZOPFLI_LONGEST_MATCH_CACHE
-  s.lmc = (ZopfliLongestMatchCache*)malloc(sizeof(ZopfliLongestMatchCache));
-  ZopfliInitCache(blocksize, s.lmc);
+  s.lmc = NewBlockCache(options, blocksize);
 #endif
 
   ZopfliLZ77Optimal(&s, in, instart, inend, &store);
@@ -612,10 +789,8 @@ static void DeflateDynamicBlock(const ZopfliOptions* options, int final,
     ZopfliLZ77Store fixedstore;
     ZopfliInitLZ77Store(&fixedstore);
     ZopfliLZ77OptimalFixed(&s, in, instart, inend, &fixedstore);
-    dyncost = ZopfliCalculateBlockSize(store.litlens, store.dists,
-        0, store.size, 2);
-    fixedcost = ZopfliCalculateBlockSize(fixedstore.litlens, fixedstore.dists,
-        0, fixedstore.size, 1);
+    dyncost = ZopfliCalculateBlockSize(&store, 0, store.size, 2);
+    fixedcost = ZopfliCalculateBlockSize(&fixedstore, 0, fixedstore.size, 1);
     if (fixedcost < dyncost) {
       btype = 1;
       ZopfliCleanLZ77Store(&store);
@@ -625,13 +800,12 @@ static void DeflateDynamicBlock(const ZopfliOptions* options, int final,
     }
   }
 
-  AddLZ77Block(s.options, btype, final,
-               store.litlens, store.dists, 0, store.size,
-               blocksize, bp, out, outsize);
+  ZopfliEnterPhase(options, "encode");
+  AddLZ77Block(s.options, btype, final, &store, 0, store.size,
+               blocksize, w);
 
 #ifdef ZOPFLI_LONGEST_MATCH_CACHE
-  ZopfliCleanCache(s.lmc);
-  free(s.lmc);
+  DeleteBlockCache(s.lmc);
 #endif
   ZopfliCleanLZ77Store(&store);
 }
@@ -639,8 +813,7 @@ static void DeflateDynamicBlock(const ZopfliOptions* options, int final,
 static void DeflateFixedBlock(const ZopfliOptions* options, int final,
                               const unsigned char* in,
                               size_t instart, size_t inend,
-                              unsigned char* bp,
-                              unsigned char** out, size_t* outsize) {
+                              BitWriter* w) {
   ZopfliBlockState s;
   size_t blocksize = inend - instart;
   ZopfliLZ77Store store;
@@ -651,18 +824,17 @@ static void DeflateFixedBlock(const ZopfliOptions* options, int final,
   s.blockstart = instart;
   s.blockend = inend;
 #ifdef ZOPFLI_LONGEST_MATCH_CACHE
-  s.lmc = (ZopfliLongestMatchCache*)malloc(sizeof(ZopfliLongestMatchCache));
-  ZopfliInitCache(blocksize, s.lmc);
+  s.lmc = NewBlockCache(options, blocksize);
 #endif
 
   ZopfliLZ77OptimalFixed(&s, in, instart, inend, &store);
 
-  AddLZ77Block(s.options, 1, final, store.litlens, store.dists, 0, store.size,
-               blocksize, bp, out, outsize);
+  ZopfliEnterPhase(options, "encode");
+  AddLZ77Block(s.options, 1, final, &store, 0, store.size,
+               blocksize, w);
 
 #ifdef ZOPFLI_LONGEST_MATCH_CACHE
-  ZopfliCleanCache(s.lmc);
-  free(s.lmc);
+  DeleteBlockCache(s.lmc);
 #endif
   ZopfliCleanLZ77Store(&store);
 }
@@ -670,46 +842,42 @@ static void DeflateFixedBlock(const ZopfliOptions* options, int final,
 static void DeflateNonCompressedBlock(const ZopfliOptions* options, int final,
                                       const unsigned char* in, size_t instart,
                                       size_t inend,
-                                      unsigned char* bp,
-                                      unsigned char** out, size_t* outsize) {
-  size_t i;
+                                      BitWriter* w) {
   size_t blocksize = inend - instart;
   unsigned short nlen = ~blocksize;
 
   (void)options;
   assert(blocksize < 65536);  /* Non compressed blocks are max this size. */
 
-  AddBit(final, bp, out, outsize);
+  AddBit(final, w);
   /* BTYPE 00 */
-  AddBit(0, bp, out, outsize);
-  AddBit(0, bp, out, outsize);
+  AddBit(0, w);
+  AddBit(0, w);
 
   /* Any bits of input up to the next byte boundary are ignored. */
-  *bp = 0;
+  BitWriterAlignToByte(w);
 
-  ZOPFLI_APPEND_DATA(blocksize % 256, out, outsize);
-  ZOPFLI_APPEND_DATA((blocksize / 256) % 256, out, outsize);
-  ZOPFLI_APPEND_DATA(nlen % 256, out, outsize);
-  ZOPFLI_APPEND_DATA((nlen / 256) % 256, out, outsize);
+  BitWriterReserve(w, blocksize + 4);
+  w->data[w->size++] = blocksize % 256;
+  w->data[w->size++] = (blocksize / 256) % 256;
+  w->data[w->size++] = nlen % 256;
+  w->data[w->size++] = (nlen / 256) % 256;
 
-  for (i = instart; i < inend; i++) {
-    ZOPFLI_APPEND_DATA(in[i], out, outsize);
-  }
+  memcpy(w->data + w->size, in + instart, blocksize);
+  w->size += blocksize;
 }
 
 static void DeflateBlock(const ZopfliOptions* options,
                          int btype, int final,
                          const unsigned char* in, size_t instart, size_t inend,
-                         unsigned char* bp,
-                         unsigned char** out, size_t* outsize) {
+                         BitWriter* w) {
   if (btype == 0) {
-    DeflateNonCompressedBlock(
-        options, final, in, instart, inend, bp, out, outsize);
+    DeflateNonCompressedBlock(options, final, in, instart, inend, w);
   } else if (btype == 1) {
-     DeflateFixedBlock(options, final, in, instart, inend, bp, out, outsize);
+     DeflateFixedBlock(options, final, in, instart, inend, w);
   } else {
     assert (btype == 2);
-    DeflateDynamicBlock(options, final, in, instart, inend, bp, out, outsize);
+    DeflateDynamicBlock(options, final, in, instart, inend, w);
   }
 }
 
@@ -722,8 +890,7 @@ static void DeflateSplittingFirst(const ZopfliOptions* options,
                                   int btype, int final,
                                   const unsigned char* in,
                                   size_t instart, size_t inend,
-                                  unsigned char* bp,
-                                  unsigned char** out, size_t* outsize) {
+                                  BitWriter* w) {
   size_t i;
   size_t* splitpoints = 0;
   size_t npoints = 0;
@@ -732,7 +899,8 @@ static void DeflateSplittingFirst(const ZopfliOptions* options,
   } else if (btype == 1) {
     /* If all blocks are fixed tree, splitting into separate blocks only
     increases the total size. Leave npoints at 0, this represents 1 block. */
-  } else {
+  } else if (!ZopfliStopped(options)) {
+    ZopfliEnterPhase(options, "blocksplit");
     ZopfliBlockSplit(options, in, instart, inend,
                      options->blocksplittingmax, &splitpoints, &npoints);
   }
@@ -740,8 +908,7 @@ static void DeflateSplittingFirst(const ZopfliOptions* options,
   for (i = 0; i <= npoints; i++) {
     size_t start = i == 0 ? instart : splitpoints[i - 1];
     size_t end = i == npoints ? inend : splitpoints[i];
-    DeflateBlock(options, btype, i == npoints && final, in, start, end,
-                 bp, out, outsize);
+    DeflateBlock(options, btype, i == npoints && final, in, start, end, w);
   }
 
   free(splitpoints);
@@ -756,8 +923,7 @@ static void DeflateSplittingLast(const ZopfliOptions* options,
                                  int btype, int final,
                                  const unsigned char* in,
                                  size_t instart, size_t inend,
-                                 unsigned char* bp,
-                                 unsigned char** out, size_t* outsize) {
+                                 BitWriter* w) {
   size_t i;
   ZopfliBlockState s;
   ZopfliLZ77Store store;
@@ -767,9 +933,7 @@ static void DeflateSplittingLast(const ZopfliOptions* options,
   if (btype == 0) {
     /* This function only supports LZ77 compression. DeflateSplittingFirst
        supports the special case of noncompressed data. Punt it to that one. */
-    DeflateSplittingFirst(options, btype, final,
-                          in, instart, inend,
-                          bp, out, outsize);
+    DeflateSplittingFirst(options, btype, final, in, instart, inend, w);
   }
   assert(btype == 1 || btype == 2);
 
@@ -779,8 +943,7 @@ static void DeflateSplittingLast(const ZopfliOptions* options,
   s.blockstart = instart;
   s.blockend = inend;
 #ifdef ZOPFLI_LONGEST_MATCH_CACHE
-  s.lmc = (ZopfliLongestMatchCache*)malloc(sizeof(ZopfliLongestMatchCache));
-  ZopfliInitCache(inend - instart, s.lmc);
+  s.lmc = NewBlockCache(options, inend - instart);
 #endif
 
   if (btype == 2) {
@@ -793,22 +956,22 @@ static void DeflateSplittingLast(const ZopfliOptions* options,
   if (btype == 1) {
     /* If all blocks are fixed tree, splitting into separate blocks only
     increases the total size. Leave npoints at 0, this represents 1 block. */
-  } else {
-    ZopfliBlockSplitLZ77(options, store.litlens, store.dists, store.size,
+  } else if (!ZopfliStopped(options)) {
+    ZopfliEnterPhase(options, "blocksplit");
+    ZopfliBlockSplitLZ77(options, &store,
                          options->blocksplittingmax, &splitpoints, &npoints);
   }
 
+  ZopfliEnterPhase(options, "encode");
   for (i = 0; i <= npoints; i++) {
     size_t start = i == 0 ? 0 : splitpoints[i - 1];
     size_t end = i == npoints ? store.size : splitpoints[i];
     AddLZ77Block(options, btype, i == npoints && final,
-                 store.litlens, store.dists, start, end, 0,
-                 bp, out, outsize);
+                 &store, start, end, 0, w);
   }
 
 #ifdef ZOPFLI_LONGEST_MATCH_CACHE
-  ZopfliCleanCache(s.lmc);
-  free(s.lmc);
+  DeleteBlockCache(s.lmc);
 #endif
 
   ZopfliCleanLZ77Store(&store);
@@ -828,17 +991,18 @@ void ZopfliDeflatePart(const ZopfliOptions* options, int btype, int final,
                        const unsigned char* in, size_t instart, size_t inend,
                        unsigned char* bp, unsigned char** out,
                        size_t* outsize) {
+  BitWriter w;
+  BitWriterInit(*bp, *out, *outsize, &w);
   if (options->blocksplitting) {
     if (options->blocksplittinglast) {
-      DeflateSplittingLast(options, btype, final, in, instart, inend,
-                           bp, out, outsize);
+      DeflateSplittingLast(options, btype, final, in, instart, inend, &w);
     } else {
-      DeflateSplittingFirst(options, btype, final, in, instart, inend,
-                            bp, out, outsize);
+      DeflateSplittingFirst(options, btype, final, in, instart, inend, &w);
     }
   } else {
-    DeflateBlock(options, btype, final, in, instart, inend, bp, out, outsize);
+    DeflateBlock(options, btype, final, in, instart, inend, &w);
   }
+  BitWriterFinish(&w, bp, out, outsize);
 }
 
 void ZopfliDeflate(const ZopfliOptions* options, int btype, int final,
@@ -25,6 +25,7 @@ Functions to compress according to the DEFLATE specification, using the
 "squeeze" LZ77 compression backend.
 */
 
+#include "lz77.h"
 #include "zopfli.h"
 
 #ifdef __cplusplus
@@ -70,15 +71,20 @@ void ZopfliDeflatePart(const ZopfliOptions* options, int btype, int final,
 
 /*
 Calculates block size in bits.
-litlens: lz77 lit/lengths
-dists: ll77 distances
+lz77: the LZ77 data, the histograms in it make this O(1) in the block length
+  for all but small blocks
 lstart: start of block
 lend: end of block (not inclusive)
 */
-double ZopfliCalculateBlockSize(const unsigned short* litlens,
-                                const unsigned short* dists,
+double ZopfliCalculateBlockSize(const ZopfliLZ77Store* lz77,
                                 size_t lstart, size_t lend, int btype);
 
+/* Reports the start of a compression phase to the options' phase hook. */
+void ZopfliEnterPhase(const ZopfliOptions* options, const char* name);
+
+/* Asks the options' stop hook whether to stop; 0 if there is none. */
+int ZopfliStopped(const ZopfliOptions* options);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
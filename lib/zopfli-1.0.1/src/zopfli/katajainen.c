@@ -171,10 +171,116 @@ static void ExtractBitLengths(Node* chain, Node* leaves, unsigned* bitlengths) {
 }
 
 /*
-Comparator for sorting the leaves. Has the function signature for qsort.
+Largest alphabet and bit length limit used by DEFLATE. Calls within these limits
+get all their memory from the stack, the others from the heap.
 */
-static int LeafComparator(const void* a, const void* b) {
-  return ((const Node*)a)->weight - ((const Node*)b)->weight;
+#define KATAJAINEN_MAX_SYMBOLS 288
+#define KATAJAINEN_MAX_BITS 15
+
+/*
+Sorts the leaves from lightest to heaviest with a least significant digit
+radix sort on 8-bit digits of the weight. It is stable, so leaves of equal
+weight stay in symbol order. Only as many digits as the heaviest weight has
+are sorted on.
+temp: scratch space for numsymbols leaves.
+*/
+static void SortLeaves(Node* leaves, int numsymbols, Node* temp) {
+  size_t maxweight = 0;
+  unsigned shift;
+  int i;
+  Node* from = leaves;
+  Node* to = temp;
+
+  for (i = 0; i < numsymbols; i++) {
+    if (leaves[i].weight > maxweight) maxweight = leaves[i].weight;
+  }
+
+  for (shift = 0; shift < sizeof(size_t) * 8 && (maxweight >> shift) != 0;
+       shift += 8) {
+    size_t offsets[256];
+    size_t pos = 0;
+    Node* swap;
+    for (i = 0; i < 256; i++) offsets[i] = 0;
+    for (i = 0; i < numsymbols; i++) {
+      offsets[(from[i].weight >> shift) & 255]++;
+    }
+    for (i = 0; i < 256; i++) {
+      size_t count = offsets[i];
+      offsets[i] = pos;
+      pos += count;
+    }
+    for (i = 0; i < numsymbols; i++) {
+      to[offsets[(from[i].weight >> shift) & 255]++] = from[i];
+    }
+    swap = from;
+    from = to;
+    to = swap;
+  }
+
+  if (from != leaves) {
+    for (i = 0; i < numsymbols; i++) leaves[i] = from[i];
+  }
+}
+
+/*
+Computes the unconstrained minimum-redundancy code lengths of the sorted leaves,
+with the in-place algorithm of Moffat and Katajainen, "In-Place Calculation of
+Minimum-Redundancy Codes". This is linear in the amount of symbols.
+a: in: the weights of the leaves, lightest first. out: their code lengths.
+n: amount of leaves, at least 2.
+returns the longest code length, which is that of a[0].
+*/
+static size_t HuffmanCodeLengths(size_t* a, int n) {
+  int root, leaf, next;
+  size_t avbl, used, depth;
+
+  /* First pass, left to right, setting parent pointers. */
+  a[0] += a[1];
+  root = 0;
+  leaf = 2;
+  for (next = 1; next < n - 1; next++) {
+    /* Select first item for a pairing. */
+    if (leaf >= n || a[root] < a[leaf]) {
+      a[next] = a[root];
+      a[root++] = next;
+    } else {
+      a[next] = a[leaf++];
+    }
+    /* Add on the second item. */
+    if (leaf >= n || (root < next && a[root] < a[leaf])) {
+      a[next] += a[root];
+      a[root++] = next;
+    } else {
+      a[next] += a[leaf++];
+    }
+  }
+
+  /* Second pass, right to left, setting internal depths. */
+  a[n - 2] = 0;
+  for (next = n - 3; next >= 0; next--) {
+    a[next] = a[a[next]] + 1;
+  }
+
+  /* Third pass, right to left, setting leaf depths. */
+  avbl = 1;
+  used = depth = 0;
+  root = n - 2;
+  next = n - 1;
+  while (avbl > 0) {
+    while (root >= 0 && a[root] == depth) {
+      used++;
+      root--;
+    }
+    while (avbl > used) {
+      a[next--] = depth;
+      avbl--;
+    }
+    avbl = 2 * used;
+    depth++;
+    used = 0;
+  }
+
+  return a[0];
 }
 
 int ZopfliLengthLimitedCodeLengths(
@@ -183,13 +289,23 @@ int ZopfliLengthLimitedCodeLengths(
   int i;
   int numsymbols = 0;  /* Amount of symbols with frequency > 0. */
   int numBoundaryPMRuns;
+  int small = n <= KATAJAINEN_MAX_SYMBOLS && maxbits <= KATAJAINEN_MAX_BITS;
+
+  /* Workspace for the common DEFLATE sizes, so that those calls do not
+  allocate. Only numsymbols leaves will be used. */
+  Node leaves_stack[KATAJAINEN_MAX_SYMBOLS];
+  Node temp_stack[KATAJAINEN_MAX_SYMBOLS];
+  Node nodes_stack[2 * KATAJAINEN_MAX_BITS * (KATAJAINEN_MAX_BITS + 1)];
+  Node* lists_stack[KATAJAINEN_MAX_BITS][2];
+  size_t depths[KATAJAINEN_MAX_SYMBOLS];
 
   /* Array of lists of chains. Each list requires only two lookahead chains at
   a time, so each list is a array of two Node*'s. */
   Node* (*lists)[2];
 
   /* One leaf per symbol. Only numsymbols leaves will be used. */
-  Node* leaves = (Node*)malloc(n * sizeof(*leaves));
+  Node* leaves = small ? leaves_stack : (Node*)malloc(n * sizeof(*leaves));
+  Node* temp = small ? temp_stack : (Node*)malloc(n * sizeof(*temp));
 
   /* Initialize all bitlengths at 0. */
   for (i = 0; i < n; i++) {
@@ -207,31 +323,48 @@ int ZopfliLengthLimitedCodeLengths(
 
   /* Check special cases and error conditions. */
   if ((1 << maxbits) < numsymbols) {
-    free(leaves);
+    if (!small) free(leaves);
+    if (!small) free(temp);
     return 1;  /* Error, too few maxbits to represent symbols. */
   }
   if (numsymbols == 0) {
-    free(leaves);
+    if (!small) free(leaves);
+    if (!small) free(temp);
     return 0;  /* No symbols at all. OK. */
   }
   if (numsymbols == 1) {
     bitlengths[leaves[0].count] = 1;
-    free(leaves);
+    if (!small) free(leaves);
+    if (!small) free(temp);
     return 0;  /* Only one symbol, give it bitlength 1, not 0. OK. */
   }
 
   /* Sort the leaves from lightest to heaviest. */
-  qsort(leaves, numsymbols, sizeof(Node), LeafComparator);
+  SortLeaves(leaves, numsymbols, temp);
+  if (!small) free(temp);
+
+  /* If a plain Huffman code already fits in maxbits it is optimal and the
+  length limiting package-merge below is not needed. */
+  if (small) {
+    for (i = 0; i < numsymbols; i++) depths[i] = leaves[i].weight;
+    if (HuffmanCodeLengths(depths, numsymbols) <= (size_t)maxbits) {
+      for (i = 0; i < numsymbols; i++) {
+        bitlengths[leaves[i].count] = depths[i];
+      }
+      return 0;  /* OK. */
+    }
+  }
 
   /* Initialize node memory pool. */
   pool.size = 2 * maxbits * (maxbits + 1);
-  pool.nodes = (Node*)malloc(pool.size * sizeof(*pool.nodes));
+  pool.nodes = small ? nodes_stack
+                     : (Node*)malloc(pool.size * sizeof(*pool.nodes));
   pool.next = pool.nodes;
   for (i = 0; i < pool.size; i++) {
     pool.nodes[i].inuse = 0;
   }
 
-  lists = (Node* (*)[2])malloc(maxbits * sizeof(*lists));
+  lists = small ? lists_stack : (Node* (*)[2])malloc(maxbits * sizeof(*lists));
   InitLists(&pool, leaves, maxbits, lists);
 
   /* In the last list, 2 * numsymbols - 2 active chains need to be created. Two
@@ -244,8 +377,10 @@ int ZopfliLengthLimitedCodeLengths(
 
   ExtractBitLengths(lists[maxbits - 1][1], leaves, bitlengths);
 
-  free(lists);
-  free(leaves);
-  free(pool.nodes);
+  if (!small) {
+    free(lists);
+    free(leaves);
+    free(pool.nodes);
+  }
   return 0;  /* OK. */
 }
@@ -18,6 +18,7 @@ Author: jyrki.alakuijala@gmail.com (Jyrki Alakuijala)
 */
 
 #include "lz77.h"
+#include "match.h"
 #include "util.h"
 
 #include <assert.h>
@@ -25,31 +26,80 @@ Author: jyrki.alakuijala@gmail.com (Jyrki Alakuijala)
 #include <stdlib.h>
 
 void ZopfliInitLZ77Store(ZopfliLZ77Store* store) {
+  store->entries = 0;
   store->size = 0;
-  store->litlens = 0;
-  store->dists = 0;
+  store->capacity = 0;
+  store->ll_counts = 0;
+  store->d_counts = 0;
 }
 
 void ZopfliCleanLZ77Store(ZopfliLZ77Store* store) {
-  free(store->litlens);
-  free(store->dists);
+  free(store->entries);  /* The start of the arena. */
+}
+
+/* Rounds size up to a whole amount of histogram chunks of the given size. */
+static size_t CeilDiv(size_t size, size_t chunk) {
+  return (size + chunk - 1) / chunk;
+}
+
+void ZopfliReserveLZ77Store(size_t capacity, ZopfliLZ77Store* store) {
+  /* Arena layout: entries, then ll_counts, then d_counts. The entries part is
+  padded so that the counts are aligned. */
+  size_t entrybytes = sizeof(ZopfliLZ77Entry) * capacity;
+  size_t llsize = ZOPFLI_NUM_LL * CeilDiv(capacity, ZOPFLI_NUM_LL);
+  size_t dsize = ZOPFLI_NUM_D * CeilDiv(capacity, ZOPFLI_NUM_D);
+  size_t usedllsize = ZOPFLI_NUM_LL * CeilDiv(store->size, ZOPFLI_NUM_LL);
+  size_t useddsize = ZOPFLI_NUM_D * CeilDiv(store->size, ZOPFLI_NUM_D);
+  unsigned char* arena;
+  size_t* ll_counts;
+  size_t* d_counts;
+
+  if (capacity <= store->capacity) return;
+
+  entrybytes = sizeof(size_t) * CeilDiv(entrybytes, sizeof(size_t));
+  arena = (unsigned char*)malloc(
+      entrybytes + sizeof(size_t) * (llsize + dsize));
+  if (!arena) exit(-1); /* Allocation failed. */
+  ll_counts = (size_t*)(arena + entrybytes);
+  d_counts = ll_counts + llsize;
+
+  if (store->size > 0) {
+    memcpy(arena, store->entries, sizeof(ZopfliLZ77Entry) * store->size);
+    memcpy(ll_counts, store->ll_counts, sizeof(size_t) * usedllsize);
+    memcpy(d_counts, store->d_counts, sizeof(size_t) * useddsize);
+  }
+  free(store->entries);
+
+  store->entries = (ZopfliLZ77Entry*)arena;
+  store->ll_counts = ll_counts;
+  store->d_counts = d_counts;
+  store->capacity = capacity;
+}
+
+void ZopfliResetLZ77Store(ZopfliLZ77Store* store) {
+  /* The histogram chunks are rewritten as entries are appended again. */
+  store->size = 0;
+}
+
+void ZopfliSwapLZ77Store(ZopfliLZ77Store* a, ZopfliLZ77Store* b) {
+  ZopfliLZ77Store temp = *a;
+  *a = *b;
+  *b = temp;
 }
 
 void ZopfliCopyLZ77Store(
     const ZopfliLZ77Store* source, ZopfliLZ77Store* dest) {
-  size_t i;
-  ZopfliCleanLZ77Store(dest);
-  dest->litlens =
-      (unsigned short*)malloc(sizeof(*dest->litlens) * source->size);
-  dest->dists = (unsigned short*)malloc(sizeof(*dest->dists) * source->size);
-
-  if (!dest->litlens || !dest->dists) exit(-1); /* Allocation failed. */
+  size_t llsize = ZOPFLI_NUM_LL * CeilDiv(source->size, ZOPFLI_NUM_LL);
+  size_t dsize = ZOPFLI_NUM_D * CeilDiv(source->size, ZOPFLI_NUM_D);
+  ZopfliResetLZ77Store(dest);
+  ZopfliReserveLZ77Store(source->size, dest);
 
   dest->size = source->size;
-  for (i = 0; i < source->size; i++) {
-    dest->litlens[i] = source->litlens[i];
-    dest->dists[i] = source->dists[i];
-  }
+  if (source->size == 0) return;
+  memcpy(dest->entries, source->entries,
+         sizeof(ZopfliLZ77Entry) * source->size);
+  memcpy(dest->ll_counts, source->ll_counts, sizeof(size_t) * llsize);
+  memcpy(dest->d_counts, source->d_counts, sizeof(size_t) * dsize);
 }
 
 /*
@@ -58,9 +108,46 @@ context must be a ZopfliLZ77Store*.
 */
 void ZopfliStoreLitLenDist(unsigned short length, unsigned short dist,
                            ZopfliLZ77Store* store) {
-  size_t size2 = store->size;  /* Needed for using ZOPFLI_APPEND_DATA twice. */
-  ZOPFLI_APPEND_DATA(length, &store->litlens, &store->size);
-  ZOPFLI_APPEND_DATA(dist, &store->dists, &size2);
+  size_t origsize = store->size;
+  size_t llstart = ZOPFLI_NUM_LL * (origsize / ZOPFLI_NUM_LL);
+  size_t dstart = ZOPFLI_NUM_D * (origsize / ZOPFLI_NUM_D);
+  ZopfliLZ77Entry* entry;
+
+  if (origsize == store->capacity) {
+    ZopfliReserveLZ77Store(
+        origsize == 0 ? ZOPFLI_NUM_LL : origsize * 2, store);
+  }
+
+  /* Everytime the index wraps around, a new cumulative histogram is made: it
+  starts as a copy of the previous chunk's counts. */
+  if (origsize % ZOPFLI_NUM_LL == 0) {
+    if (origsize == 0) {
+      memset(store->ll_counts, 0, sizeof(size_t) * ZOPFLI_NUM_LL);
+    } else {
+      memcpy(store->ll_counts + llstart, store->ll_counts + llstart -
+             ZOPFLI_NUM_LL, sizeof(size_t) * ZOPFLI_NUM_LL);
+    }
+  }
+  if (origsize % ZOPFLI_NUM_D == 0) {
+    if (origsize == 0) {
+      memset(store->d_counts, 0, sizeof(size_t) * ZOPFLI_NUM_D);
+    } else {
+      memcpy(store->d_counts + dstart, store->d_counts + dstart -
+             ZOPFLI_NUM_D, sizeof(size_t) * ZOPFLI_NUM_D);
+    }
+  }
+
+  entry = &store->entries[origsize];
+  entry->litlen = length;
+  entry->dist = dist;
+  store->size++;
+
+  if (dist == 0) {
+    store->ll_counts[llstart + length]++;
+  } else {
+    store->ll_counts[llstart + ZopfliGetLengthSymbol(length)]++;
+    store->d_counts[dstart + ZopfliGetDistSymbol(dist)]++;
+  }
 }
 
 /*
@@ -114,42 +201,11 @@ after scan, which is still equal to the correspondinb byte after match.
 scan is the position to compare
 match is the earlier position to compare.
 end is the last possible byte, beyond which to stop looking.
-safe_end is a few (8) bytes before end, for comparing multiple bytes at once.
 */
 static const unsigned char* GetMatch(const unsigned char* scan,
                                      const unsigned char* match,
-                                     const unsigned char* end,
-                                     const unsigned char* safe_end) {
-
-  if (sizeof(size_t) == 8) {
-    /* 8 checks at once per array bounds check (size_t is 64-bit). */
-    while (scan < safe_end && *((size_t*)scan) == *((size_t*)match)) {
-      scan += 8;
-      match += 8;
-    }
-  } else if (sizeof(unsigned int) == 4) {
-    /* 4 checks at once per array bounds check (unsigned int is 32-bit). */
-    while (scan < safe_end
-        && *((unsigned int*)scan) == *((unsigned int*)match)) {
-      scan += 4;
-      match += 4;
-    }
-  } else {
-    /* do 8 checks at once per array bounds check. */
-    while (scan < safe_end && *scan == *match && *++scan == *++match
-          && *++scan == *++match && *++scan == *++match
-          && *++scan == *++match && *++scan == *++match
-          && *++scan == *++match && *++scan == *++match) {
-      scan++; match++;
-    }
-  }
-
-  /* The remaining few bytes. */
-  while (scan != end && *scan == *match) {
-    scan++; match++;
-  }
-
-  return scan;
+                                     const unsigned char* end) {
+  return scan + ZopfliMatchLength(scan, match, end - scan);
 }
 
 #ifdef ZOPFLI_LONGEST_MATCH_CACHE
@@ -236,7 +292,6 @@ void ZopfliFindLongestMatch(ZopfliBlockState* s, const ZopfliHash* h,
   const unsigned char* scan;
   const unsigned char* match;
   const unsigned char* arrayend;
-  const unsigned char* arrayend_safe;
 #if ZOPFLI_MAX_CHAIN_HITS < ZOPFLI_WINDOW_SIZE
   int chain_counter = ZOPFLI_MAX_CHAIN_HITS;  /* For quitting early. */
 #endif
@@ -271,7 +326,6 @@ void ZopfliFindLongestMatch(ZopfliBlockState* s, const ZopfliHash* h,
     limit = size - pos;
   }
   arrayend = &array[pos] + limit;
-  arrayend_safe = arrayend - 8;
 
   assert(hval < 65536);
 
@@ -310,7 +364,7 @@ void ZopfliFindLongestMatch(ZopfliBlockState* s, const ZopfliHash* h,
           match += same;
         }
 #endif
-        scan = GetMatch(scan, match, arrayend, arrayend_safe);
+        scan = GetMatch(scan, match, arrayend);
         currentlength = scan - &array[pos];  /* The found length. */
       }
 
@@ -456,8 +510,7 @@ void ZopfliLZ77Greedy(ZopfliBlockState* s, const unsigned char* in,
   ZopfliCleanHash(h);
 }
 
-void ZopfliLZ77Counts(const unsigned short* litlens,
-                      const unsigned short* dists,
+void ZopfliLZ77Counts(const ZopfliLZ77Store* lz77,
                       size_t start, size_t end,
                       size_t* ll_count, size_t* d_count) {
   size_t i;
@@ -470,13 +523,75 @@ void ZopfliLZ77Counts(const unsigned short* litlens,
   }
 
   for (i = start; i < end; i++) {
-    if (dists[i] == 0) {
-      ll_count[litlens[i]]++;
+    const ZopfliLZ77Entry* entry = &lz77->entries[i];
+    if (entry->dist == 0) {
+      ll_count[entry->litlen]++;
     } else {
-      ll_count[ZopfliGetLengthSymbol(litlens[i])]++;
-      d_count[ZopfliGetDistSymbol(dists[i])]++;
+      ll_count[ZopfliGetLengthSymbol(entry->litlen)]++;
+      d_count[ZopfliGetDistSymbol(entry->dist)]++;
     }
   }
 
   ll_count[256] = 1;  /* End symbol. */
 }
+
+/*
+Gets the histogram of all entries up to and including lpos. The cumulative
+counts of the chunk containing lpos are taken, and the entries of that chunk
+that come after lpos are subtracted again.
+*/
+static void LZ77GetHistogramAt(const ZopfliLZ77Store* lz77, size_t lpos,
+                               size_t* ll_counts, size_t* d_counts) {
+  size_t llpos = ZOPFLI_NUM_LL * (lpos / ZOPFLI_NUM_LL);
+  size_t dpos = ZOPFLI_NUM_D * (lpos / ZOPFLI_NUM_D);
+  size_t i;
+
+  for (i = 0; i < ZOPFLI_NUM_LL; i++) {
+    ll_counts[i] = lz77->ll_counts[llpos + i];
+  }
+  for (i = lpos + 1; i < llpos + ZOPFLI_NUM_LL && i < lz77->size; i++) {
+    const ZopfliLZ77Entry* entry = &lz77->entries[i];
+    if (entry->dist == 0) {
+      ll_counts[entry->litlen]--;
+    } else {
+      ll_counts[ZopfliGetLengthSymbol(entry->litlen)]--;
+    }
+  }
+
+  for (i = 0; i < ZOPFLI_NUM_D; i++) {
+    d_counts[i] = lz77->d_counts[dpos + i];
+  }
+  for (i = lpos + 1; i < dpos + ZOPFLI_NUM_D && i < lz77->size; i++) {
+    if (lz77->entries[i].dist != 0) {
+      d_counts[ZopfliGetDistSymbol(lz77->entries[i].dist)]--;
+    }
+  }
+}
+
+void ZopfliLZ77GetHistogram(const ZopfliLZ77Store* lz77,
+                            size_t lstart, size_t lend,
+                            size_t* ll_counts, size_t* d_counts) {
+  size_t i;
+
+  /* For short ranges, counting directly is cheaper than two chunk lookups. */
+  if (lstart + ZOPFLI_NUM_LL * 3 > lend) {
+    ZopfliLZ77Counts(lz77, lstart, lend, ll_counts, d_counts);
+    return;
+  }
+
+  LZ77GetHistogramAt(lz77, lend - 1, ll_counts, d_counts);
+  if (lstart > 0) {
+    size_t ll_counts2[ZOPFLI_NUM_LL];
+    size_t d_counts2[ZOPFLI_NUM_D];
+    LZ77GetHistogramAt(lz77, lstart - 1, ll_counts2, d_counts2);
+
+    for (i = 0; i < ZOPFLI_NUM_LL; i++) {
+      ll_counts[i] -= ll_counts2[i];
+    }
+    for (i = 0; i < ZOPFLI_NUM_D; i++) {
+      d_counts[i] -= d_counts2[i];
+    }
+  }
+
+  ll_counts[256] = 1;  /* End symbol. */
+}
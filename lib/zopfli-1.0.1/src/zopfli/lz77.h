@@ -31,21 +31,41 @@ compression.
 #include "hash.h"
 #include "zopfli.h"
 
+/*
+One lit/length and dist pair of LZ77 data.
+litlen: the literal symbol or length value.
+dist: the distance. A value of 0 indicates that there is no dist and litlen is
+a literal instead of a length.
+*/
+typedef struct ZopfliLZ77Entry {
+  unsigned short litlen;
+  unsigned short dist;
+} ZopfliLZ77Entry;
+
 /*
 Stores lit/length and dist pairs for LZ77.
-Parameter litlens: Contains the literal symbols or length values.
-Parameter dists: Contains the distances. A value is 0 to indicate that there is
-no dist and the corresponding litlens value is a literal instead of a length.
-Parameter size: The size of both the litlens and dists arrays.
+Parameter entries: The lit/length and dist pairs, interleaved so that walking
+the data touches a single array.
+Parameter size: The amount of entries.
+Parameter capacity: The amount of entries there is room for.
+Parameter ll_counts, d_counts: Cumulative histograms of the lit/len and dist
+symbols, sampled once per chunk of ZOPFLI_NUM_LL (resp. ZOPFLI_NUM_D) entries.
+Chunk k holds the symbol counts of all entries before the end of that chunk,
+which lets ZopfliLZ77GetHistogram count any range without walking it.
+All three arrays live in a single allocation (the arena) that starts at
+entries, and only grows when the capacity is exceeded.
 The memory can best be managed by using ZopfliInitLZ77Store to initialize it,
 ZopfliCleanLZ77Store to destroy it, and ZopfliStoreLitLenDist to append values.
-
+ZopfliResetLZ77Store empties the store but keeps the arena, so a store that is
+refilled many times only allocates once.
 */
 typedef struct ZopfliLZ77Store {
-  unsigned short* litlens;  /* Lit or len. */
-  unsigned short* dists;  /* If 0: indicates literal in corresponding litlens,
-      if > 0: length in corresponding litlens, this is the distance. */
+  ZopfliLZ77Entry* entries;
   size_t size;
+  size_t capacity;
+
+  size_t* ll_counts;  /* Cumulative lit/len symbol counts per chunk. */
+  size_t* d_counts;  /* Cumulative dist symbol counts per chunk. */
 } ZopfliLZ77Store;
 
 void ZopfliInitLZ77Store(ZopfliLZ77Store* store);
@@ -54,6 +74,18 @@ void ZopfliCopyLZ77Store(const ZopfliLZ77Store* source, ZopfliLZ77Store* dest);
 void ZopfliStoreLitLenDist(unsigned short length, unsigned short dist,
                            ZopfliLZ77Store* store);
 
+/*
+Makes room for at least capacity entries, e.g. the length of the block that
+will be compressed into the store, so that appending does not reallocate.
+*/
+void ZopfliReserveLZ77Store(size_t capacity, ZopfliLZ77Store* store);
+
+/* Removes all entries, but keeps the allocated memory for reuse. */
+void ZopfliResetLZ77Store(ZopfliLZ77Store* store);
+
+/* Exchanges the contents of two stores, without copying any entries. */
+void ZopfliSwapLZ77Store(ZopfliLZ77Store* a, ZopfliLZ77Store* b);
+
 /*
 Some state information for compressing a block.
 This is currently a bit under-used (with mainly only the longest match cache),
@@ -101,20 +133,29 @@ void ZopfliVerifyLenDist(const unsigned char* data, size_t datasize, size_t pos,
 
 /*
 Counts the number of literal, length and distance symbols in the given lz77
-arrays.
-litlens: lz77 lit/lengths
-dists: ll77 distances
-start: where to begin counting in litlens and dists
-end: where to stop counting in litlens and dists (not inclusive)
+data.
+lz77: the lz77 data
+start: where to begin counting in the entries
+end: where to stop counting in the entries (not inclusive)
 ll_count: count of each lit/len symbol, must have size 288 (see deflate
     standard)
 d_count: count of each dist symbol, must have size 32 (see deflate standard)
 */
-void ZopfliLZ77Counts(const unsigned short* litlens,
-                      const unsigned short* dists,
+void ZopfliLZ77Counts(const ZopfliLZ77Store* lz77,
                       size_t start, size_t end,
                       size_t* ll_count, size_t* d_count);
 
+/*
+Gets the lit/len and dist symbol histograms of the range [lstart, lend) of the
+store, in O(ZOPFLI_NUM_LL) time rather than O(lend - lstart), using the chunked
+cumulative counts. Gives the same result as ZopfliLZ77Counts on that range.
+ll_counts: output, must have size ZOPFLI_NUM_LL
+d_counts: output, must have size ZOPFLI_NUM_D
+*/
+void ZopfliLZ77GetHistogram(const ZopfliLZ77Store* lz77,
+                            size_t lstart, size_t lend,
+                            size_t* ll_counts, size_t* d_counts);
+
 /*
 Does LZ77 using an algorithm similar to gzip, with lazy matching, rather than
 with the slow but better "squeeze" implementation.
@@ -0,0 +1,122 @@
+/*
+Copyright 2011 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+Author: lode.vandevenne@gmail.com (Lode Vandevenne)
+Author: jyrki.alakuijala@gmail.com (Jyrki Alakuijala)
+*/
+
+#include "match.h"
+
+#include <string.h>
+
+/*
+The AVX2 version is compiled with a target attribute, so the rest of the library
+does not require AVX2, and is only used if the CPU turns out to support it.
+*/
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ZOPFLI_MATCH_AVX2
+#include <immintrin.h>
+#endif
+
+/*
+Whether the first differing byte of two words can be found by counting the
+trailing zero bits of their XOR: needs a little endian target and a count
+trailing zeros builtin for the word type.
+*/
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define ZOPFLI_MATCH_CTZ
+#endif
+
+/*
+Returns the index of the first differing byte of two words that are known to
+differ.
+*/
+static size_t FirstDifferentByte(size_t a, size_t b) {
+  size_t x = a ^ b;
+#ifdef ZOPFLI_MATCH_CTZ
+  if (sizeof(size_t) == sizeof(unsigned long)) {
+    return (size_t)__builtin_ctzl((unsigned long)x) / 8;
+  }
+#endif
+  {
+    /* Portable fallback: compare the bytes in memory order. */
+    unsigned char ba[sizeof(size_t)];
+    unsigned char bb[sizeof(size_t)];
+    size_t i;
+    memcpy(ba, &a, sizeof(size_t));
+    memcpy(bb, &b, sizeof(size_t));
+    for (i = 0; i < sizeof(size_t); i++) {
+      if (ba[i] != bb[i]) break;
+    }
+    (void)x;
+    return i;
+  }
+}
+
+/* Compares one word at a time, the loads may be unaligned. */
+static size_t MatchLengthWord(const unsigned char* scan,
+                              const unsigned char* match, size_t limit) {
+  size_t i = 0;
+  while (i + sizeof(size_t) <= limit) {
+    size_t a, b;
+    memcpy(&a, scan + i, sizeof(size_t));
+    memcpy(&b, match + i, sizeof(size_t));
+    if (a != b) return i + FirstDifferentByte(a, b);
+    i += sizeof(size_t);
+  }
+  /* The remaining few bytes. */
+  while (i < limit && scan[i] == match[i]) i++;
+  return i;
+}
+
+#ifdef ZOPFLI_MATCH_AVX2
+__attribute__((target("avx2")))
+static size_t MatchLengthAVX2(const unsigned char* scan,
+                              const unsigned char* match, size_t limit) {
+  size_t i = 0;
+  while (i + 32 <= limit) {
+    __m256i a = _mm256_loadu_si256((const __m256i*)(scan + i));
+    __m256i b = _mm256_loadu_si256((const __m256i*)(match + i));
+    unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b));
+    if (mask != 0xffffffffu) {
+      return i + (size_t)__builtin_ctz(~mask);
+    }
+    i += 32;
+  }
+  return i + MatchLengthWord(scan + i, match + i, limit - i);
+}
+#endif
+
+typedef size_t MatchLengthFun(const unsigned char* scan,
+                              const unsigned char* match, size_t limit);
+
+/* Picks the fastest implementation this CPU supports. */
+static MatchLengthFun* SelectMatchLength(void) {
+#ifdef ZOPFLI_MATCH_AVX2
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return MatchLengthAVX2;
+#endif
+  return MatchLengthWord;
+}
+
+size_t ZopfliMatchLength(const unsigned char* scan, const unsigned char* match,
+                         size_t limit) {
+  /* Selecting twice from concurrent first calls is harmless: both store the
+  same pointer. */
+  static MatchLengthFun* match_length = 0;
+  if (!match_length) match_length = SelectMatchLength();
+  return match_length(scan, match, limit);
+}
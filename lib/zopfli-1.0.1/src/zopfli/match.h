@@ -0,0 +1,42 @@
+/*
+Copyright 2011 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+Author: lode.vandevenne@gmail.com (Lode Vandevenne)
+Author: jyrki.alakuijala@gmail.com (Jyrki Alakuijala)
+*/
+
+/*
+Match extension for LZ77: finds how many bytes two positions of the data have
+in common. This is the innermost loop of ZopfliFindLongestMatch, and is also
+meant for any other match finder that needs it.
+*/
+
+#ifndef ZOPFLI_MATCH_H_
+#define ZOPFLI_MATCH_H_
+
+#include <stdlib.h>
+
+/*
+Returns how many bytes starting from scan and from match are equal, looking at
+no more than limit bytes. match is normally an earlier position in the same
+array as scan, but both must be readable for limit bytes.
+On x86 CPUs that support AVX2 (checked once, at the first call) 32 bytes are
+compared per step, else 8 bytes per step using a 64-bit XOR and counting the
+trailing zeros to locate the first differing byte.
+*/
+size_t ZopfliMatchLength(const unsigned char* scan, const unsigned char* match,
+                         size_t limit);
+
+#endif  /* ZOPFLI_MATCH_H_ */
@@ -397,15 +397,12 @@ static void CalculateStatistics(SymbolStats* stats) {
 
 /* Appends the symbol statistics from the store. */
 static void GetStatistics(const ZopfliLZ77Store* store, SymbolStats* stats) {
+  size_t ll_counts[ZOPFLI_NUM_LL];
+  size_t d_counts[ZOPFLI_NUM_D];
   size_t i;
-  for (i = 0; i < store->size; i++) {
-    if (store->dists[i] == 0) {
-      stats->litlens[store->litlens[i]]++;
-    } else {
-      stats->litlens[ZopfliGetLengthSymbol(store->litlens[i])]++;
-      stats->dists[ZopfliGetDistSymbol(store->dists[i])]++;
-    }
-  }
+  ZopfliLZ77GetHistogram(store, 0, store->size, ll_counts, d_counts);
+  for (i = 0; i < ZOPFLI_NUM_LL; i++) stats->litlens[i] += ll_counts[i];
+  for (i = 0; i < ZOPFLI_NUM_D; i++) stats->dists[i] += d_counts[i];
   stats->litlens[256] = 1;  /* End symbol. */
 
   CalculateStatistics(stats);
@@ -454,6 +451,7 @@ void ZopfliLZ77Optimal(ZopfliBlockState *s,
   unsigned short* path = 0;
   size_t pathsize = 0;
   ZopfliLZ77Store currentstore;
+  const ZopfliLZ77Store* laststore;  /* The store of the latest run. */
   SymbolStats stats, beststats, laststats;
   int i;
   double cost;
@@ -473,31 +471,41 @@ void ZopfliLZ77Optimal(ZopfliBlockState *s,
   the statistics of the previous run. */
 
   /* Initial run. */
+  ZopfliEnterPhase(s->options, "greedy");
   ZopfliLZ77Greedy(s, in, instart, inend, &currentstore);
   GetStatistics(&currentstore, &stats);
 
+  /* The runs produce about as many symbols as the greedy one. Both stores are
+  sized for that once; the runs then reuse currentstore, and the best run is
+  swapped rather than copied into the output store. */
+  ZopfliReserveLZ77Store(currentstore.capacity, store);
+
   /* Repeat statistics with each time the cost model from the previous stat
   run. */
   for (i = 0; i < s->options->numiterations; i++) {
-    ZopfliCleanLZ77Store(&currentstore);
-    ZopfliInitLZ77Store(&currentstore);
+    if (ZopfliStopped(s->options)) {
+      break;
+    }
+    ZopfliEnterPhase(s->options, "squeeze");
+    ZopfliResetLZ77Store(&currentstore);
     LZ77OptimalRun(s, in, instart, inend, &path, &pathsize,
                    length_array, GetCostStat, (void*)&stats,
                    &currentstore);
-    cost = ZopfliCalculateBlockSize(currentstore.litlens, currentstore.dists,
-                                    0, currentstore.size, 2);
+    cost = ZopfliCalculateBlockSize(&currentstore, 0, currentstore.size, 2);
     if (s->options->verbose_more || (s->options->verbose && cost < bestcost)) {
       fprintf(stderr, "Iteration %d: %d bit\n", i, (int) cost);
     }
+    laststore = &currentstore;
     if (cost < bestcost) {
-      /* Copy to the output store. */
-      ZopfliCopyLZ77Store(&currentstore, store);
+      /* Move to the output store, the previous best becomes scratch space. */
+      ZopfliSwapLZ77Store(&currentstore, store);
+      laststore = store;
       CopyStats(&stats, &beststats);
       bestcost = cost;
     }
     CopyStats(&stats, &laststats);
     ClearStatFreqs(&stats);
-    GetStatistics(&currentstore, &stats);
+    GetStatistics(laststore, &stats);
     if (lastrandomstep != -1) {
       /* This makes it converge slower but better. Do it only once the
       randomness kicks in so that if the user does few iterations, it gives a
@@ -513,6 +521,10 @@ void ZopfliLZ77Optimal(ZopfliBlockState *s,
     }
     lastcost = cost;
   }
+  if (bestcost == ZOPFLI_LARGE_FLOAT) {
+    /* Stopped before the first iteration: the greedy run is the result. */
+    ZopfliSwapLZ77Store(&currentstore, store);
+  }
 
   free(length_array);
   free(path);
@@ -538,6 +550,7 @@ void ZopfliLZ77OptimalFixed(ZopfliBlockState *s,
 
   /* Shortest path for fixed tree This one should give the shortest possible
   result for fixed tree, no repeated runs are needed since the tree is known. */
+  ZopfliEnterPhase(s->options, "squeeze");
   LZ77OptimalRun(s, in, instart, inend, &path, &pathsize,
                  length_array, GetCostFixed, 0, store);
 
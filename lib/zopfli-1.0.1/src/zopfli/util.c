@@ -210,4 +210,9 @@ void ZopfliInitOptions(ZopfliOptions* options) {
   options->blocksplitting = 1;
   options->blocksplittinglast = 0;
   options->blocksplittingmax = 15;
+  options->stop = 0;
+  options->stop_context = 0;
+  options->phase = 0;
+  options->phase_context = 0;
+  options->cachemaxblocksize = 0;
 }
@@ -55,6 +55,13 @@ Set this to, for example, 20MB (20000000). Set it to 0 to disable master blocks.
 */
 #define ZOPFLI_MASTER_BLOCK_SIZE 20000000
 
+/*
+Number of distinct literal/length and distance symbols in DEFLATE. These are
+also the chunk sizes of the cumulative histograms kept in ZopfliLZ77Store.
+*/
+#define ZOPFLI_NUM_LL 288
+#define ZOPFLI_NUM_D 32
+
 /*
 Used to initialize costs for example
 */
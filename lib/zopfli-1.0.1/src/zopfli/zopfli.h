@@ -64,6 +64,32 @@ typedef struct ZopfliOptions {
   extreme results that hurt compression on some files). Default value: 15.
   */
   int blocksplittingmax;
+
+  /*
+  If not NULL, called with stop_context before each LZ77 optimization
+  iteration and before block splitting and each of its steps; a nonzero return
+  ends the iterations early, keeping the greedy LZ77 if none ran, and ends the
+  splitting with the blocks found so far. Lets the caller bound the time spent.
+  Default: NULL.
+  */
+  int (*stop)(void* stop_context);
+  void* stop_context;
+
+  /*
+  If not NULL, called with phase_context and the name of each phase of the
+  compression as it starts: "blocksplit", "greedy", "squeeze" (once per
+  iteration) and "encode". Lets the caller time the phases. Default: NULL.
+  */
+  void (*phase)(void* phase_context, const char* name);
+  void* phase_context;
+
+  /*
+  Largest block, in bytes, to keep the longest match cache for (0 for no
+  limit). The cache takes about 28 bytes per input byte of the block being
+  optimized; larger blocks are optimized without it, slower but in less
+  memory. Default: 0.
+  */
+  size_t cachemaxblocksize;
 } ZopfliOptions;
 
 /* Initializes options with default values. */
@@ -0,0 +1,336 @@
+#include "pngz.h"
+#include "cache.h"
+#include "helpers.h"
+
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+// Results are kept in a directory, with a subdirectory per image named after
+// its pixel hash holding one file per set of options named after their hash,
+// so looking an image up never lists more than its own entries. The
+// directory has to exist already; without it nothing is read or recorded. A
+// file holds the winning encoding, its row filter vector and the whole
+// output PNG, so a hit only has to copy it out, and a search under other
+// options can start from the encoding and filters.
+// Entries are written to a temporary file and renamed into place, so
+// concurrent runs sharing the directory never see a partial entry; the last
+// writer of a key wins.
+//
+// The key leaves out how the pixels were encoded, so one entry serves inputs
+// of any size: the search finds nothing smaller than result_size for them,
+// and an input no larger than that is left as it is. Each entry also hashes
+// the file it left as the result, which is how pngz knows its own output
+// when it comes back.
+
+#define CACHE_MAGIC "PNGZC\0\0\4"
+
+typedef struct cache_header_s {
+    char magic[8];
+    uint64_t pixel_hash[2];
+    uint64_t options_hash[2];
+    uint8_t improved;     // 0 if the search didn't beat the input
+    uint8_t color_type;
+    uint8_t bit_depth;
+    uint8_t transparent_fill;
+    uint8_t color_key;
+    uint8_t effort;
+    uint8_t reserved[2];
+    uint32_t height;      // Length of the row filter vector, 0 if not improved
+    uint64_t png_size;    // Length of the output PNG, 0 if not improved
+    uint64_t result_size; // The output's size, or the input's if the search
+                          // didn't beat it
+    uint64_t result_hash[2]; // Hash of that file
+} cache_header;
+
+// Hashes the decoded image, so differently encoded copies of one image share
+// entries.
+static void pixel_hash(const pngz_t *png, uint64_t out[2]) {
+    const uint64_t size[2] = {png->width, png->height};
+    hash128(size, sizeof(size), 0, out);
+    hash128(png->raw_pixels, sizeof(raw_pixel)*png->width*png->height,
+            out[0], out);
+}
+
+// Hashes the options that change what the search finds.
+static void options_hash(const pngz_params *options, uint64_t out[2]) {
+    char format[32];
+    sprintf(format, "pngz cache 1 effort %d", options->effort);
+    hash128(format, strlen(format), 0, out);
+}
+
+// The directory holding the image's entries.
+static char* image_dir(const char *dir, const uint64_t pixels[2]) {
+    char *path = malloc(strlen(dir) + 40);
+    sprintf(path, "%s/%016llx%016llx", dir,
+            (unsigned long long)pixels[0], (unsigned long long)pixels[1]);
+    return path;
+}
+
+static char* entry_path(const char *dir, const uint64_t pixels[2],
+                        const uint64_t options[2]) {
+    char *image = image_dir(dir, pixels);
+    char *path = malloc(strlen(image) + 48);
+    sprintf(path, "%s/%016llx%016llx.pngzc", image,
+            (unsigned long long)options[0], (unsigned long long)options[1]);
+    free(image);
+    return path;
+}
+
+typedef struct cache_entry_s {
+    cache_header header;
+    uint8_t *row_filters; // NULL if not improved
+    uint8_t *png;         // NULL if not improved
+} cache_entry;
+
+static void free_entry(cache_entry *entry) {
+    free(entry->row_filters);
+    free(entry->png);
+}
+
+// Reads the entry at `path`. Returns false if it is missing, belongs to other
+// pixels, or doesn't add up to its file's size or hold a PNG: directories are
+// shared, and a truncated or corrupt file must never become a result.
+static bool read_entry(const pngz_t *png, const char *path,
+                       const uint64_t pixels[2], cache_entry *entry) {
+    static const uint8_t signature[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+    cache_header *header = &entry->header;
+    entry->row_filters = NULL;
+    entry->png = NULL;
+    FILE *fp = fopen(path, "rb");
+    if(!fp) {
+        return false;
+    }
+    struct stat st;
+    bool ok = fstat(fileno(fp), &st) == 0 &&
+              fread(header, sizeof(cache_header), 1, fp) == 1 &&
+              !memcmp(header->magic, CACHE_MAGIC, 8) &&
+              !memcmp(header->pixel_hash, pixels, sizeof(uint64_t[2])) &&
+              header->height == (header->improved ? png->height : 0) &&
+              header->png_size <= (uint64_t)st.st_size &&
+              (uint64_t)st.st_size == sizeof(cache_header) + header->height +
+                                      header->png_size;
+    if(ok && header->improved) {
+        entry->row_filters = malloc(header->height);
+        entry->png = header->png_size >= sizeof(signature) ?
+                     malloc(header->png_size) : NULL;
+        ok = entry->row_filters && entry->png &&
+             fread(entry->row_filters, 1, header->height, fp) ==
+             header->height &&
+             fread(entry->png, 1, header->png_size, fp) == header->png_size &&
+             !memcmp(entry->png, signature, sizeof(signature));
+    }
+    fclose(fp);
+    if(!ok) {
+        free_entry(entry);
+    }
+    return ok;
+}
+
+// Whether the entry's result is the input itself, made at this effort or a
+// higher one.
+static bool made_input(const pngz_t *png, const cache_header *header,
+                       const uint64_t input_hash[2]) {
+    return header->effort >= png->options->effort &&
+           header->result_size == png->original_size &&
+           !memcmp(header->result_hash, input_hash, sizeof(uint64_t[2]));
+}
+
+// Reads, of the improved entries for the same pixels, the one with the
+// smallest output into best. Returns false if there is none. *own_output is
+// set if some entry made the input.
+static bool read_near_hit(const pngz_t *png, const char *dir,
+                          const uint64_t pixels[2],
+                          const uint64_t input_hash[2], cache_entry *best,
+                          bool *own_output) {
+    *own_output = false;
+
+    static const char suffix[] = ".pngzc";
+    char *image = image_dir(dir, pixels);
+    DIR *d = opendir(image);
+    if(!d) {
+        free(image);
+        return false;
+    }
+    bool found = false;
+    struct dirent *dirent;
+    while((dirent = readdir(d)) != NULL) {
+        // Leaves out temporary files still being written.
+        const size_t length = strlen(dirent->d_name);
+        if(length < sizeof(suffix) || strcmp(dirent->d_name + length -
+                                             (sizeof(suffix) - 1), suffix)) {
+            continue;
+        }
+        char *path = malloc(strlen(image) + length + 2);
+        sprintf(path, "%s/%s", image, dirent->d_name);
+        cache_entry entry;
+        if(read_entry(png, path, pixels, &entry)) {
+            if(made_input(png, &entry.header, input_hash)) {
+                *own_output = true;
+            }
+            if(entry.png && (!found ||
+               entry.header.png_size < best->header.png_size)) {
+                if(found) {
+                    free_entry(best);
+                }
+                *best = entry;
+                found = true;
+            }
+            else {
+                free_entry(&entry);
+            }
+        }
+        free(path);
+    }
+    closedir(d);
+    free(image);
+    return found;
+}
+
+// Makes the improved entry's output the best result.
+static void take_output(pngz_t *png, cache_entry *entry) {
+    free(png->best_png);
+    png->best_png = entry->png;
+    entry->png = NULL;
+    png->best_size = entry->header.png_size;
+    png->best_color_type = entry->header.color_type;
+    png->best_bit_depth = entry->header.bit_depth;
+    png->best_transparent_fill = entry->header.transparent_fill;
+    png->best_color_key = entry->header.color_key;
+    png->best_filter_strategy = "cached";
+    if(!png->best_row_filters) {
+        png->best_row_filters = malloc(png->height);
+    }
+    memcpy(png->best_row_filters, entry->row_filters, png->height);
+}
+
+// Looks the image up in the cache directory, if there is one. On a hit the
+// cached output, if smaller than the input, becomes the result and true is
+// returned: there is nothing left to do. An input that some entry made at
+// this effort or a higher one left as its result is pngz's own output, and
+// is passed through unless forced. Otherwise the best entry for the same
+// pixels under other options gives the search a place to start: its output
+// is the result to beat, and its encoding and row filters are tried first.
+bool cache_lookup(pngz_t *png) {
+    const char *dir = png->options->cache_dir;
+    if(!dir) {
+        return false;
+    }
+
+    uint64_t pixels[2], options[2], input_hash[2];
+    pixel_hash(png, pixels);
+    options_hash(png->options, options);
+    hash128(png->input, png->original_size, 0, input_hash);
+
+    cache_entry entry;
+    char *path = entry_path(dir, pixels, options);
+    const bool found = read_entry(png, path, pixels, &entry);
+    free(path);
+    if(found && made_input(png, &entry.header, input_hash)) {
+        // Left to the own output check below.
+        free_entry(&entry);
+    }
+    else if(found) {
+        bool hit = false;
+        if(entry.png && entry.header.png_size < png->best_size) {
+            take_output(png, &entry);
+            hit = true;
+        }
+        else if(png->best_size <= entry.header.result_size) {
+            hit = true;
+        }
+        free_entry(&entry);
+        if(hit) {
+            return true;
+        }
+        // A larger encoding of pixels whose search didn't beat a smaller
+        // one: this input may still be beaten.
+    }
+
+    bool own_output;
+    const bool near_hit = read_near_hit(png, dir, pixels, input_hash, &entry,
+                                         &own_output);
+    if(own_output && !png->options->force) {
+        png->passed_through = true;
+        if(near_hit) {
+            free_entry(&entry);
+        }
+        return false;
+    }
+    if(near_hit) {
+        if(entry.header.png_size < png->best_size) {
+            take_output(png, &entry);
+        }
+        png->warm_color_type = entry.header.color_type;
+        png->warm_bit_depth = entry.header.bit_depth;
+        png->warm_transparent_fill = entry.header.transparent_fill;
+        png->warm_color_key = entry.header.color_key;
+        png->warm_row_filters = entry.row_filters;
+        entry.row_filters = NULL;
+        free_entry(&entry);
+    }
+    return false;
+}
+
+// Records the result of a finished search.
+void cache_store(const pngz_t *png) {
+    const char *dir = png->options->cache_dir;
+    if(!dir) {
+        return;
+    }
+
+    cache_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CACHE_MAGIC, 8);
+    pixel_hash(png, header.pixel_hash);
+    options_hash(png->options, header.options_hash);
+    header.improved = png->best_size < png->original_size;
+    header.color_type = png->best_color_type;
+    header.bit_depth = png->best_bit_depth;
+    header.transparent_fill = png->best_transparent_fill;
+    header.color_key = png->best_color_key;
+    header.effort = png->options->effort;
+    header.result_size = png->best_size;
+    if(png->best_png) {
+        hash128(png->best_png, png->best_size, 0, header.result_hash);
+    }
+    else {
+        hash128(png->input, png->original_size, 0, header.result_hash);
+    }
+
+    if(header.improved) {
+        header.png_size = png->best_size;
+        header.height = png->height;
+    }
+
+    // The image's directory may already exist, made by this or another run.
+    char *image = image_dir(dir, header.pixel_hash);
+    mkdir(image, 0777);
+    free(image);
+
+    char *path = entry_path(dir, header.pixel_hash, header.options_hash);
+    char *tmp_path = malloc(strlen(path) + 32);
+    sprintf(tmp_path, "%s.%ld.%p.tmp", path, (long)getpid(), (void*)png);
+
+    FILE *fp = fopen(tmp_path, "wb");
+    if(fp) {
+        bool ok = fwrite(&header, sizeof(header), 1, fp) == 1;
+        if(header.improved) {
+            ok = ok && fwrite(png->best_row_filters, 1, header.height, fp) ==
+                       header.height;
+            ok = ok && fwrite(png->best_png, 1, header.png_size, fp) ==
+                       header.png_size;
+        }
+        ok = fclose(fp) == 0 && ok;
+        if(!ok || rename(tmp_path, path) != 0) {
+            remove(tmp_path);
+        }
+    }
+
+    free(tmp_path);
+    free(path);
+}
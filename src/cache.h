@@ -0,0 +1,10 @@
+#ifndef PNGZ_CACHE_H_
+#define PNGZ_CACHE_H_
+
+#include "pngz.h"
+#include <stdbool.h>
+
+bool cache_lookup(pngz_t *png);
+void cache_store(const pngz_t *png);
+
+#endif
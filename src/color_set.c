@@ -0,0 +1,96 @@
+#include "pngz.h"
+#include "color_set.h"
+#include "helpers.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Transparent pixels are all the same color as far as the set is concerned.
+raw_pixel normalize_transparent(raw_pixel pixel) {
+    if(pixel.alpha == 0) {
+        pixel.red = 0;
+        pixel.green = 0;
+        pixel.blue = 0;
+    }
+    return pixel;
+}
+
+static size_t color_hash(raw_pixel color) {
+    const uint64_t key = convert_raw_pixel_to_uint64(color);
+    return (key * 0x9E3779B97F4A7C15ULL) >> 54; // top 10 bits
+}
+
+// Returns the slot holding `color`, or the empty slot it would go in.
+static size_t find_slot(const color_set *cset, raw_pixel color) {
+    size_t slot = color_hash(color);
+    for(;;) {
+        const int16_t index = cset->slots[slot];
+        if(index < 0 || raw_pixel_cmp(cset->colors[index], color) == 0) {
+            return slot;
+        }
+        slot = (slot + 1) & (COLOR_SET_SLOTS - 1);
+    }
+}
+
+// Returns the index of `color` in the set, or -1 if it isn't in it.
+int color_set_index(const color_set *cset, raw_pixel color) {
+    return cset->slots[find_slot(cset, color)];
+}
+
+int color_set_contains(const color_set *cset, raw_pixel color) {
+    return color_set_index(cset, color) >= 0;
+}
+
+int color_set_contains_rgba(const color_set *cset, uint16_t red,
+                            uint16_t green, uint16_t blue, uint16_t alpha,
+                            uint8_t bit_depth) {
+    raw_pixel color;
+    color.red = convert_bit_depth(red, bit_depth, 16);
+    color.green = convert_bit_depth(green, bit_depth, 16);
+    color.blue = convert_bit_depth(blue, bit_depth, 16);
+    color.alpha = convert_bit_depth(alpha, bit_depth, 16);
+    return color_set_contains(cset, color);
+}
+
+// Collects the distinct colors of the image and how often each is used. Only
+// palette sized sets are of interest, so once more than COLOR_SET_MAX colors
+// are seen the set is marked as overflowed and collection stops.
+color_set* extract_color_set(const raw_pixel *pixels, size_t total_pixels) {
+
+    color_set *cset = malloc(sizeof(color_set));
+    cset->size = 0;
+    cset->overflow = false;
+    memset(cset->slots, 0xff, sizeof(cset->slots));
+
+    raw_pixel last;
+    int last_index = -1;
+
+    size_t i;
+    for(i=0;i<total_pixels;i++) {
+        const raw_pixel current = normalize_transparent(pixels[i]);
+        // Runs of one color are common, skip the hash for them.
+        if(last_index >= 0 && raw_pixel_cmp(current, last) == 0) {
+            cset->counts[last_index]++;
+            continue;
+        }
+        const size_t slot = find_slot(cset, current);
+        if(cset->slots[slot] < 0) {
+            if(cset->size == COLOR_SET_MAX) {
+                cset->overflow = true;
+                break;
+            }
+            cset->slots[slot] = cset->size;
+            cset->colors[cset->size] = current;
+            cset->counts[cset->size] = 0;
+            cset->size++;
+        }
+        last = current;
+        last_index = cset->slots[slot];
+        cset->counts[last_index]++;
+    }
+    return cset;
+}
+
+void free_color_set(color_set *cset) {
+    free(cset);
+}
@@ -0,0 +1,33 @@
+#ifndef PNGZ_COLOR_SET_H_
+#define PNGZ_COLOR_SET_H_
+
+#include "pngz.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// Palettes hold at most this many colors; the color set stops growing past it.
+#define COLOR_SET_MAX 256
+
+// Open addressing table, kept at most a quarter full.
+#define COLOR_SET_SLOTS 1024
+
+typedef struct color_set_s {
+    size_t size;
+    raw_pixel colors[COLOR_SET_MAX];
+    unsigned int counts[COLOR_SET_MAX];
+    int16_t slots[COLOR_SET_SLOTS];
+    bool overflow;
+} color_set;
+
+raw_pixel normalize_transparent(raw_pixel pixel);
+
+color_set* extract_color_set(const raw_pixel *pixels, size_t total_pixels);
+void free_color_set(color_set *cset);
+
+int color_set_index(const color_set *cset, raw_pixel color);
+int color_set_contains(const color_set *cset, raw_pixel color);
+int color_set_contains_rgba(const color_set *cset, uint16_t red,
+                            uint16_t green, uint16_t blue, uint16_t alpha,
+                            uint8_t bit_depth);
+
+#endif
@@ -1,16 +1,16 @@
 #include "pngz.h"
 #include "colortypes.h"
 #include "helpers.h"
+#include "pack.h"
+#include "color_set.h"
+#include "palette.h"
+#include "filter.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
-
-typedef struct color_set_s {
-    size_t size;
-    size_t capacity;
-    raw_pixel *colors;
-} color_set;
+#include <math.h>
+#include <string.h>
 
 typedef struct png_analysis_s{
     bool has_color_pixels;
@@ -18,91 +18,107 @@ typedef struct png_analysis_s{
     unsigned int total_semitransparent_px;
     unsigned int minimum_bit_depth;
     color_set *cset;
+    unsigned int histograms[4][256];
 } png_analysis;
 
+// A (color type, bit depth) encoding that can represent the image losslessly,
+// with the size the planner expects it to compress to.
+typedef struct ct_candidate_s {
+    uint8_t color_type;
+    uint8_t bit_depth;
+    uint8_t transparent_fill;
+    bool color_key;  // Transparency as a tRNS color instead of alpha
+    uint16_t key[3]; // That color, at bit_depth
+    size_t overhead;
+    double estimated_size;
+} ct_candidate;
+
+#define MAX_CANDIDATES 8
+
+// What fully transparent pixels get as color. Their color is invisible, so
+// color types with an alpha channel can store whatever filters best.
+enum {
+    FILL_KEEP, // Leave as loaded
+    FILL_ZERO, // Black
+    FILL_LEFT, // Copy of the pixel to the left, what Sub predicts
+    FILL_UP,   // Copy of the pixel above, what Up predicts
+    NUM_FILLS
+};
+
+// Fill variants estimated within this ratio of the best one are all tried.
+#define FILL_PRUNE_RATIO 1.05
+
+typedef struct ct_plan_s {
+    size_t size;
+    ct_candidate candidates[MAX_CANDIDATES];
+} ct_plan;
 
-void ct2_8(pngz_t *png, png_analysis *analysis,
-           void(*callback)(pngz_t*, void*));
-/*
-void ct0(pngz_t *png, uint8_t bit_depth, analysis*);
-
-void ct3(pngz_t *png, uint8_t bit_depth, analysis*);
-void ct4(pngz_t *png, uint8_t bit_depth, analysis*);
-void ct6(pngz_t *png, uint8_t bit_depth, analysis*);
-*/
+// Signature + IHDR + IEND + IDAT chunk overhead.
+#define PNG_FIXED_OVERHEAD (8 + 25 + 12 + 12)
 
 png_analysis* analyze_png(pngz_t*);
 void free_png_analysis(png_analysis*);
+static void plan_colortypes(pngz_t*, const png_analysis*, ct_plan*);
+static void deflate_estimates(pngz_t*, png_analysis*, ct_plan*);
+static void warm_start(const pngz_t*, ct_plan*);
+static void encode_candidate(pngz_t*, png_analysis*, const ct_candidate*,
+                             void(*callback)(pngz_t*, void*));
 
 void colortype_dispatch(pngz_t *png, void(*callback)(pngz_t*, void*)) {
 
+    double start = monotonic_seconds();
     png_analysis *analysis = analyze_png(png);
-    printf("minimum_bit_depth = %d\n", analysis->minimum_bit_depth);
-    printf("total colors = %d\n", analysis->cset->size);
-    /*
-    if(analysis->minimum_bit_depth <= 8 &&
-       analysis->total_semitransparent_px == 0 &&
-       analysis->total_transparent_px ==0) {
-        ct2_8(png, analysis, callback);
-    }
-    */
-    ct2_8(png, analysis, callback);
-    free_png_analysis(analysis);
-}
-
-// COLOR SET ////////////////////////////////////////////////
-
-int color_set_contains(color_set* cset, raw_pixel color) {
-    unsigned int i;
-    for(i=0;i<cset->size;i++) {
-        if(raw_pixel_cmp(cset->colors[i], color) == 0) {
-            return 1;
+    trace_event(png->trace, "analyze", monotonic_seconds() - start,
+                png->width * png->height * sizeof(raw_pixel), NULL);
+    if(png->options->verbose) {
+        printf("minimum_bit_depth = %d\n", analysis->minimum_bit_depth);
+        if(analysis->cset->overflow) {
+            printf("total colors > %d\n", COLOR_SET_MAX);
+        }
+        else {
+            printf("total colors = %zu\n", analysis->cset->size);
         }
     }
-    return 0;
-}
-
-int color_set_contains_rgba(color_set *cset, uint16_t red, uint16_t green,
-                            uint16_t blue, uint16_t alpha, uint8_t bit_depth) {
-    raw_pixel color;
-    color.red = convert_bit_depth(red, bit_depth, 16);
-    color.green = convert_bit_depth(green, bit_depth, 16);
-    color.blue = convert_bit_depth(blue, bit_depth, 16);
-    color.alpha = convert_bit_depth(alpha, bit_depth, 16);
-    return color_set_contains(cset, color);
-}
-
-color_set* extract_color_set(raw_pixel *pixels, size_t total_pixels) {
 
-    color_set *cset = malloc(sizeof(color_set));
-    cset->colors = malloc(sizeof(raw_pixel)*256);
-    cset->capacity = 256;
-    cset->size = 0;
-    raw_pixel current;
+    ct_plan plan;
+    start = monotonic_seconds();
+    plan_colortypes(png, analysis, &plan);
+    trace_event(png->trace, "plan", monotonic_seconds() - start, 0,
+                "\"candidates\":%zu", plan.size);
+
+    if(png->effort->estimator == ESTIMATE_DEFLATED) {
+        start = monotonic_seconds();
+        deflate_estimates(png, analysis, &plan);
+        trace_event(png->trace, "estimate", monotonic_seconds() - start, 0,
+                    "\"candidates\":%zu", plan.size);
+    }
 
-    unsigned int i;
-    for(i=0;i<total_pixels;i++) {
-        current = pixels[i];
-        if(current.alpha == 0) {
-            current.red = 0;
-            current.green = 0;
-            current.blue = 0;
+    // Candidates come best-first, so the bounds below tighten early.
+    const double best_estimate = plan.size > 0 ?
+                                 plan.candidates[0].estimated_size : 0;
+    if(png->warm_row_filters) {
+        warm_start(png, &plan);
+    }
+    const effort_preset *effort = png->effort;
+    size_t i;
+    int tried = 0;
+    for(i=0;i<plan.size;i++) {
+        const ct_candidate *candidate = &plan.candidates[i];
+        if(candidate->overhead >= png->best_size) {
+            continue; // Can't beat the best result even with an empty IDAT
         }
-        if(!color_set_contains(cset, current)) {
-            if(cset->size == cset->capacity){
-                cset->capacity <<= 1;
-                cset->colors = realloc(cset->colors, cset->capacity);
-            }
-            cset->colors[cset->size] = current;
-            cset->size++;
+        if(i > 0 && effort->prune_ratio != 0 &&
+           candidate->estimated_size > best_estimate * effort->prune_ratio) {
+            continue;
         }
+        if(png->deadline_reached ||
+           (effort->color_types != 0 && tried == effort->color_types)) {
+            break;
+        }
+        encode_candidate(png, analysis, candidate, callback);
+        tried++;
     }
-    return cset;
-}
-
-void free_color_set(color_set *cset) {
-    free(cset->colors);
-    free(cset);
+    free_png_analysis(analysis);
 }
 
 // ANALYSIS ////////////////////////////////////////////////
@@ -143,16 +159,13 @@ static int pixel_bit_depth_floor(raw_pixel pixel) {
     uint8_t red_min = bit_depth_floor(pixel.red);
     uint8_t green_min = bit_depth_floor(pixel.green);
     uint8_t blue_min = bit_depth_floor(pixel.blue);
-    
-    if(red_min > green_min && red_min > blue_min) {
-        return red_min;
-    }
-    else if(green_min > red_min && green_min > blue_min) {
-        return green_min;
-    }
-    else {
-        return blue_min;
-    }
+    uint8_t alpha_min = bit_depth_floor(pixel.alpha);
+
+    uint8_t depth = red_min;
+    if(green_min > depth) depth = green_min;
+    if(blue_min > depth) depth = blue_min;
+    if(alpha_min > depth) depth = alpha_min;
+    return depth;
 }
 
 png_analysis* analyze_png(pngz_t *png) {
@@ -166,10 +179,17 @@ png_analysis* analyze_png(pngz_t *png) {
     unsigned int num_transparent_px = 0;
     unsigned int num_semitransparent_px = 0;
 
+    png_analysis *analysis = calloc(1, sizeof(png_analysis));
+
     for(i=0;i<total_px;i++) {
 
         raw_pixel current = pixels[i];
 
+        analysis->histograms[0][current.red >> 8]++;
+        analysis->histograms[1][current.green >> 8]++;
+        analysis->histograms[2][current.blue >> 8]++;
+        analysis->histograms[3][current.alpha >> 8]++;
+
         if(greyscale && is_color(current)) {
             greyscale = false;
         }
@@ -187,8 +207,6 @@ png_analysis* analyze_png(pngz_t *png) {
         }
     }
 
-    png_analysis *analysis = malloc(sizeof(png_analysis));
-
     analysis->has_color_pixels = !greyscale;
     analysis->total_transparent_px = num_transparent_px;
     analysis->total_semitransparent_px = num_semitransparent_px;
@@ -203,72 +221,465 @@ void free_png_analysis(png_analysis *analysis) {
     free(analysis);
 }
 
-// CT Helpers
+// PLANNER ////////////////////////////////////////////////
 
-void* ct_alloc(const size_t width, const size_t height,
-               const size_t bits_per_pixel) {
-    if(bits_per_pixel*width % 8 == 0) {
-        return malloc(height*width*bits_per_pixel);
+// Order-0 entropy in bits per value of a histogram over `total` values.
+static double entropy(const unsigned int *histogram, size_t n, size_t total) {
+    double bits = 0;
+    size_t i;
+    for(i=0;i<n;i++) {
+        if(histogram[i] != 0) {
+            double p = (double)histogram[i] / total;
+            bits -= p * log2(p);
+        }
+    }
+    return bits;
+}
+
+static unsigned int palette_bit_depth(size_t colors) {
+    if(colors <= 2) return 1;
+    if(colors <= 4) return 2;
+    if(colors <= 16) return 4;
+    return 8;
+}
+
+static unsigned int samples_per_pixel(uint8_t color_type) {
+    switch(color_type) {
+        case 0: return 1;
+        case 2: return 3;
+        case 3: return 1;
+        case 4: return 2;
+        case 6: return 4;
+        default: exit(1);
+    }
+}
+
+// Expected IDAT payload plus everything the candidate adds around it. The
+// payload is the raw size scaled down by the per-pixel entropy of the samples
+// the color type stores; deflate usually does better, but the ordering is
+// what matters here.
+static void estimate_candidate(const pngz_t *png, const png_analysis *analysis,
+                               ct_candidate *candidate) {
+    const size_t total_px = png->width * png->height;
+    const unsigned int raw_bits = candidate->bit_depth *
+                                  samples_per_pixel(candidate->color_type);
+    const color_set *cset = analysis->cset;
+    double bits;
+
+    candidate->overhead = PNG_FIXED_OVERHEAD;
+
+    if(candidate->color_type == 3) {
+        bits = entropy(cset->counts, cset->size, total_px);
+        candidate->overhead += 12 + 3*cset->size;
+        if(analysis->total_transparent_px > 0 ||
+           analysis->total_semitransparent_px > 0) {
+            candidate->overhead += 12 + cset->size;
+        }
     }
     else {
-        const size_t bytes_per_row = (bits_per_pixel*width + 7)/8;
-        return calloc(height, bytes_per_row);
+        const unsigned int (*h)[256] = analysis->histograms;
+        bits = entropy(h[0], 256, total_px);
+        if(candidate->color_type == 2 || candidate->color_type == 6) {
+            bits += entropy(h[1], 256, total_px) +
+                    entropy(h[2], 256, total_px);
+        }
+        if(candidate->color_type == 4 || candidate->color_type == 6) {
+            bits += entropy(h[3], 256, total_px);
+        }
+        if(candidate->color_key) {
+            candidate->overhead += 12 + 2*samples_per_pixel(
+                                            candidate->color_type);
+        }
+        // Histograms only see the high byte of each sample.
+        if(candidate->bit_depth == 16) {
+            bits *= 2;
+        }
+    }
+    if(bits > raw_bits) {
+        bits = raw_bits;
     }
+
+    // Every row also carries a filter type byte.
+    candidate->estimated_size = candidate->overhead + png->height +
+                                bits * total_px / 8;
 }
 
-// COLORTYPE 0 ////////////////////////////////////////////////
-/*
-void ct0() {
+static void add_candidate(const pngz_t *png, const png_analysis *analysis,
+                          ct_plan *plan, uint8_t color_type,
+                          uint8_t bit_depth) {
+    ct_candidate *candidate = &plan->candidates[plan->size++];
+    memset(candidate, 0, sizeof(ct_candidate));
+    candidate->color_type = color_type;
+    candidate->bit_depth = bit_depth;
+    candidate->transparent_fill = FILL_KEEP;
+    estimate_candidate(png, analysis, candidate);
+}
 
-    uint16_t* data = ct_calloc(bit_depth);
+static bool find_color_key(const pngz_t*, bool grey, uint8_t bit_depth,
+                           uint16_t *key);
+
+// Binary transparency can drop the alpha channel if some color is left over
+// to mark transparent pixels with. Greyscale may need a deeper bit depth
+// before one is.
+static void add_key_candidate(const pngz_t *png, const png_analysis *analysis,
+                              ct_plan *plan, bool grey, uint8_t bit_depth) {
+    ct_candidate *candidate = &plan->candidates[plan->size];
+    for(;bit_depth<=16;bit_depth<<=1) {
+        if(find_color_key(png, grey, bit_depth, candidate->key)) {
+            break;
+        }
+        if(!grey) return;
+    }
+    if(bit_depth > 16) return;
+
+    plan->size++;
+    candidate->color_type = grey ? 0 : 2;
+    candidate->bit_depth = bit_depth;
+    candidate->transparent_fill = FILL_KEEP;
+    candidate->color_key = true;
+    estimate_candidate(png, analysis, candidate);
+}
 
-    pixel_writer writer;
-    writer.data = data;
-    writer.bit_depth = bit_depth;
-    writer.values_per_pixel = 1;
+static raw_pixel* fill_transparent(const pngz_t*, int fill);
+static double estimate_filtered(const pngz_t*, uint8_t color_type,
+                                uint8_t bit_depth);
+
+// Replaces the last candidate, which has an alpha channel, with one per fill
+// of the transparent pixels worth trying. Entropy can't tell the fills apart,
+// so they are compared with the filter estimator, and the candidate estimate
+// is scaled by how they compare to the best.
+static void add_fill_variants(pngz_t *png, ct_plan *plan) {
+    const ct_candidate base = plan->candidates[--plan->size];
+    raw_pixel *loaded = png->raw_pixels;
+    double estimates[NUM_FILLS];
+    int fill, best = 0;
+
+    for(fill=0;fill<NUM_FILLS;fill++) {
+        png->raw_pixels = fill_transparent(png, fill);
+        estimates[fill] = estimate_filtered(png, base.color_type,
+                                            base.bit_depth);
+        free(png->raw_pixels);
+        png->raw_pixels = loaded;
+        if(estimates[fill] < estimates[best]) {
+            best = fill;
+        }
+    }
 
-    for(i=0;i<total_px;i++){
-        write_pixel(&writer, i, png->raw_pixels[i]);
+    for(fill=0;fill<NUM_FILLS;fill++) {
+        if(estimates[fill] > estimates[best] * FILL_PRUNE_RATIO) {
+            continue;
+        }
+        ct_candidate *candidate = &plan->candidates[plan->size++];
+        *candidate = base;
+        candidate->transparent_fill = fill;
+        candidate->estimated_size *= estimates[fill] / estimates[best];
     }
+}
 
-    if(!analysis->has_transparent_pixels) {
-        callback(pngz_t, data);
+// Orders candidates by estimated size. Insertion sort keeps enumeration order
+// among equal estimates.
+static void sort_plan(ct_plan *plan) {
+    size_t i, j;
+    for(i=1;i<plan->size;i++) {
+        ct_candidate current = plan->candidates[i];
+        for(j=i;j>0 &&
+            plan->candidates[j-1].estimated_size > current.estimated_size;j--) {
+            plan->candidates[j] = plan->candidates[j-1];
+        }
+        plan->candidates[j] = current;
+    }
+}
+
+// Enumerates the encodings that represent the image losslessly, leaving out
+// those that are dominated by another one (an alpha channel for an opaque
+// image, a bit depth above the one needed), ordered by estimated size.
+static void plan_colortypes(pngz_t *png, const png_analysis *analysis,
+                            ct_plan *plan) {
+    const unsigned int depth = analysis->minimum_bit_depth;
+    const bool has_alpha = analysis->total_transparent_px > 0 ||
+                           analysis->total_semitransparent_px > 0;
+    // Color types 2, 4 and 6 only exist at 8 and 16 bits
+    const uint8_t wide_depth = depth <= 8 ? 8 : 16;
+
+    plan->size = 0;
+
+    if(!analysis->has_color_pixels) {
+        if(has_alpha) {
+            add_candidate(png, analysis, plan, 4, wide_depth);
+        }
+        else {
+            add_candidate(png, analysis, plan, 0, depth);
+        }
     }
     else {
-        // make counter to whatever
-        // while counter
-        // generate next color
-        // if color_set_contains(analysis->cset, color):
-        //      continue
-        // replace all trns indexes with this color:
-        // write_pixel(&writer, index, color);
-        // callback
+        add_candidate(png, analysis, plan, has_alpha ? 6 : 2, wide_depth);
     }
-    free(data);
+    // Fills and keys work on a second copy of the pixels.
+    const bool copies = png->memory_mode != MEMORY_MINIMAL;
+    if(copies && analysis->total_transparent_px > 0 &&
+       png->effort->estimator != ESTIMATE_ENTROPY) {
+        add_fill_variants(png, plan);
+    }
+    if(copies && analysis->total_transparent_px > 0 &&
+       analysis->total_semitransparent_px == 0) {
+        add_key_candidate(png, analysis, plan, !analysis->has_color_pixels,
+                          analysis->has_color_pixels ? wide_depth : depth);
+    }
+
+    if(!analysis->cset->overflow && depth <= 8) {
+        add_candidate(png, analysis, plan, 3,
+                      palette_bit_depth(analysis->cset->size));
+    }
+
+    sort_plan(plan);
+}
+
+static void estimate_callback(pngz_t *png, void *unfiltered) {
+    png->deflated_estimate = filter_deflated_size(png, unfiltered);
+}
+
+// Replaces the estimates with what each encoding, heuristically filtered,
+// deflates to with zlib_sweep, which tracks zopfli much closer than entropy
+// does, at the cost of encoding every candidate up front.
+static void deflate_estimates(pngz_t *png, png_analysis *analysis,
+                              ct_plan *plan) {
+    size_t i;
+    for(i=0;i<plan->size;i++) {
+        ct_candidate *candidate = &plan->candidates[i];
+        encode_candidate(png, analysis, candidate, &estimate_callback);
+        candidate->estimated_size = candidate->overhead +
+                                    png->deflated_estimate;
+    }
+    sort_plan(plan);
+}
+
+// Moves the encoding of a cached result for these pixels, which won under
+// other options, to the front of the plan.
+static void warm_start(const pngz_t *png, ct_plan *plan) {
+    size_t i;
+    for(i=0;i<plan->size;i++) {
+        const ct_candidate candidate = plan->candidates[i];
+        if(candidate.color_type == png->warm_color_type &&
+           candidate.bit_depth == png->warm_bit_depth &&
+           candidate.transparent_fill == png->warm_transparent_fill &&
+           candidate.color_key == png->warm_color_key) {
+            memmove(&plan->candidates[1], &plan->candidates[0],
+                    i * sizeof(ct_candidate));
+            plan->candidates[0] = candidate;
+            return;
+        }
+    }
+}
+
+// CT Helpers
+
+// Allocates a zeroed buffer for `height` rows of `width` pixels. Rows start on
+// a byte boundary, so sub-byte depths pad each row.
+void* ct_alloc(const size_t width, const size_t height,
+               const size_t bits_per_pixel) {
+    const size_t bytes_per_row = (bits_per_pixel*width + 7)/8;
+    return calloc(height, bytes_per_row);
+}
+
+// TRANSPARENT PIXELS ////////////////////////////////////////////////
+
+// Returns a copy of the image with the fully transparent pixels recolored.
+// Left and up fills copy from pixels already filled, so transparent runs and
+// areas become flat, and fall back to each other on the first column and row.
+static raw_pixel* fill_transparent(const pngz_t *png, int fill) {
+    const size_t width = png->width;
+    const size_t total_px = width * png->height;
+    raw_pixel *pixels = malloc(sizeof(raw_pixel)*total_px);
+    memcpy(pixels, png->raw_pixels, sizeof(raw_pixel)*total_px);
+    if(fill == FILL_KEEP) {
+        return pixels;
+    }
+
+    size_t i;
+    for(i=0;i<total_px;i++) {
+        if(pixels[i].alpha != 0) continue;
+        const size_t x = i % width;
+        raw_pixel from = {0, 0, 0, 0};
+        if(fill == FILL_LEFT) {
+            if(x > 0) from = pixels[i-1];
+            else if(i >= width) from = pixels[i-width];
+        }
+        else if(fill == FILL_UP) {
+            if(i >= width) from = pixels[i-width];
+            else if(x > 0) from = pixels[i-1];
+        }
+        pixels[i].red = from.red;
+        pixels[i].green = from.green;
+        pixels[i].blue = from.blue;
+    }
+    return pixels;
+}
+
+// COLOR KEY ////////////////////////////////////////////////
+
+// Looks for a color no opaque pixel has, to use as tRNS key. Used colors go in
+// a bitmap in one pass over the image, then the counter walks candidate keys
+// until one is free. Color images are checked on the high byte of each
+// sample, which makes a free 8 bit key a free 16 bit key too.
+static bool find_color_key(const pngz_t *png, bool grey, uint8_t bit_depth,
+                           uint16_t *key) {
+    const unsigned int places = grey ? 1 : 3;
+    const unsigned int bits = grey ? bit_depth : 8;
+    const size_t total_px = png->width * png->height;
+    uint8_t *used = calloc(((size_t)1 << (bits*places)) / 8 + 1, 1);
+    size_t i;
+
+    for(i=0;i<total_px;i++) {
+        const raw_pixel p = png->raw_pixels[i];
+        if(p.alpha == 0) continue;
+        size_t index;
+        if(grey) {
+            index = p.red >> (16 - bit_depth);
+        }
+        else {
+            index = (p.red >> 8) << 16 | (p.green >> 8) << 8 | p.blue >> 8;
+        }
+        used[index/8] |= 1 << (index%8);
+    }
+
+    counter *c = counter_create(1 << bits, places);
+    bool found = false;
+    do {
+        size_t index = 0;
+        unsigned int place;
+        for(place=0;place<places;place++) {
+            index = index << bits | counter_get(c, place);
+        }
+        if(!(used[index/8] & (1 << (index%8)))) {
+            for(place=0;place<places;place++) {
+                const uint16_t value = counter_get(c, place);
+                key[place] = bit_depth == 16 && !grey ?
+                             value << 8 | value : value;
+            }
+            found = true;
+            break;
+        }
+    } while(counter_incr(c));
+
+    counter_delete(c);
+    free(used);
+    return found;
 }
-*/
 
-// COLORTYPE 2 ////////////////////////////////////////////////
+// Returns a copy of the image with the transparent pixels set to the key.
+static raw_pixel* apply_color_key(const pngz_t *png, const uint16_t *key,
+                                  bool grey, uint8_t bit_depth) {
+    const size_t total_px = png->width * png->height;
+    raw_pixel *pixels = malloc(sizeof(raw_pixel)*total_px);
+    memcpy(pixels, png->raw_pixels, sizeof(raw_pixel)*total_px);
+
+    raw_pixel keyed;
+    keyed.red = convert_bit_depth(key[0], bit_depth, 16);
+    keyed.green = grey ? keyed.red : convert_bit_depth(key[1], bit_depth, 16);
+    keyed.blue = grey ? keyed.red : convert_bit_depth(key[2], bit_depth, 16);
+    keyed.alpha = 0;
 
+    size_t i;
+    for(i=0;i<total_px;i++) {
+        if(pixels[i].alpha == 0) {
+            pixels[i] = keyed;
+        }
+    }
+    return pixels;
+}
 
-void ct2_8(pngz_t *png, png_analysis *analysis,
-           void(*callback)(pngz_t*, void*)) {
-    png->color_type = 2;
-    png->bit_depth = 8;
-    size_t total_px = png->width * png->height;
-    uint8_t *data = calloc(1, sizeof(uint8_t)*3*total_px);
+// The tRNS chunk of color types 0 and 2: the key's samples, 16 bit big endian
+// whatever the bit depth.
+static void key_chunk(pngz_t *png, const uint16_t *key, unsigned int samples) {
     unsigned int i;
-    
-    for(i=0; i < total_px; i++) {
-        data[i*3+0] = png->raw_pixels[i].red >> 8;
-        data[i*3+1] = png->raw_pixels[i].green >> 8;
-        data[i*3+2] = png->raw_pixels[i].blue >> 8;
+    png->trns = malloc(2*samples);
+    png->trns_size = 2*samples;
+    for(i=0;i<samples;i++) {
+        png->trns[i*2] = key[i] >> 8;
+        png->trns[i*2+1] = key[i] & 0xff;
     }
+}
 
-    callback(png, data);
+// Size the filter estimator expects for the image packed as given.
+static double estimate_filtered(const pngz_t *png, uint8_t color_type,
+                                uint8_t bit_depth) {
+    const size_t row_size = packed_bytes_per_row(png->width, color_type,
+                                                 bit_depth);
+    const size_t bits_per_pixel = bit_depth*samples_per_pixel(color_type);
+    uint8_t *data = ct_alloc(png->width, png->height, bits_per_pixel);
+    pack_pixels(png, color_type, bit_depth, data);
+
+    filter_estimator *est = filter_estimator_create(row_size,
+                                                    (bits_per_pixel + 7)/8);
+    size_t y;
+    for(y=0;y<png->height;y++) {
+        filter_estimator_add_row(est, data + y*row_size);
+    }
+    const double size = filter_estimator_size(est);
+    filter_estimator_delete(est);
     free(data);
+    return size;
 }
 
-// COLORTYPE 3 ////////////////////////////////////////////////
-// COLORTYPE 4 ////////////////////////////////////////////////
-// COLORTYPE 6 ////////////////////////////////////////////////
\ No newline at end of file
+static void encode_candidate(pngz_t *png, png_analysis *analysis,
+                             const ct_candidate *candidate,
+                             void(*callback)(pngz_t*, void*)) {
+    const uint8_t color_type = candidate->color_type;
+    const uint8_t bit_depth = candidate->bit_depth;
+
+    const double start = monotonic_seconds();
+    png->color_type = color_type;
+    png->bit_depth = bit_depth;
+    png->transparent_fill = candidate->transparent_fill;
+    png->color_key = candidate->color_key;
+    uint8_t *data = ct_alloc(png->width, png->height,
+                             bit_depth*samples_per_pixel(color_type));
+
+    if(color_type == 3) {
+        uint8_t *indices = palette_color_indices(png, analysis->cset);
+        palette pal;
+        palette_choose(png, analysis->cset, indices, bit_depth, &pal);
+        palette_apply(&pal, indices, png->width * png->height);
+        palette_chunks(png, analysis->cset, &pal);
+        pack_indices(indices, png->width, png->height, bit_depth, data);
+        free(indices);
+    }
+    else if(candidate->color_key) {
+        raw_pixel *loaded = png->raw_pixels;
+        png->raw_pixels = apply_color_key(png, candidate->key,
+                                          color_type == 0, bit_depth);
+        pack_pixels(png, color_type, bit_depth, data);
+        free(png->raw_pixels);
+        png->raw_pixels = loaded;
+        key_chunk(png, candidate->key, samples_per_pixel(color_type));
+    }
+    else if(candidate->transparent_fill != FILL_KEEP) {
+        raw_pixel *loaded = png->raw_pixels;
+        png->raw_pixels = fill_transparent(png, candidate->transparent_fill);
+        pack_pixels(png, color_type, bit_depth, data);
+        free(png->raw_pixels);
+        png->raw_pixels = loaded;
+    }
+    else {
+        pack_pixels(png, color_type, bit_depth, data);
+    }
+    trace_event(png->trace, "convert", monotonic_seconds() - start,
+                png->height * packed_bytes_per_row(png->width, color_type,
+                                                   bit_depth),
+                "\"color_type\":%d,\"bit_depth\":%d,\"fill\":%d,"
+                "\"color_key\":%s",
+                color_type, bit_depth, candidate->transparent_fill,
+                candidate->color_key ? "true" : "false");
+
+    callback(png, data);
+    free(data);
+
+    if(color_type == 3) {
+        free(png->plte);
+        png->plte_size = 0;
+    }
+    if(png->trns_size != 0 || color_type == 3) {
+        free(png->trns);
+        png->trns_size = 0;
+    }
+}
@@ -1,31 +1,245 @@
 #include "compress.h"
+#include "helpers.h"
+#include "zlib_sweep.h"
 #include "zlib_container.h" // zopfli
 
 #include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
 
-static const ZopfliOptions zopfli_options = {
-    .verbose = 0,
-    .verbose_more = 0,
-    .numiterations = 15,
-    .blocksplitting = 1,
-    .blocksplittinglast = 0,
-    .blocksplittingmax = 15
-};
+// Zopfli stop hook: ends the iterations once the stop time has come, noting
+// that it did.
+typedef struct stop_clock_s {
+    double time;
+    bool stopped;
+} stop_clock;
 
-void compress(pngz_t *png, void *in, size_t insize, void(*callback)(pngz_t*)) {
+static int past_time(void *context) {
+    stop_clock *clock = context;
+    if(monotonic_seconds() >= clock->time) {
+        clock->stopped = true;
+    }
+    return clock->stopped;
+}
 
-    png->idat = NULL;
-    png->idat_size = 0;
+// Time spent in each zopfli phase, gathered through its phase hook.
+typedef struct phase_times_s {
+    const char *current;
+    double since;
+    double blocksplit;
+    double greedy;
+    double squeeze;
+    double encode;
+    int greedy_runs; // Blocks
+    int squeeze_runs; // Iterations, summed over blocks
+} phase_times;
+
+static void end_phase(phase_times *times, double now) {
+    const char *name = times->current;
+    double *total = NULL;
+    if(!name) {
+        return;
+    }
+    if(!strcmp(name, "blocksplit")) total = &times->blocksplit;
+    else if(!strcmp(name, "greedy")) total = &times->greedy;
+    else if(!strcmp(name, "squeeze")) total = &times->squeeze;
+    else if(!strcmp(name, "encode")) total = &times->encode;
+    if(total) {
+        *total += now - times->since;
+    }
+}
+
+static void enter_phase(void *context, const char *name) {
+    phase_times *times = context;
+    const double now = monotonic_seconds();
+    end_phase(times, now);
+    if(!strcmp(name, "greedy")) {
+        times->greedy_runs++;
+    }
+    if(!strcmp(name, "squeeze")) {
+        times->squeeze_runs++;
+    }
+    times->current = name;
+    times->since = now;
+}
+
+// Hashes everything the candidate's output file depends on besides the
+// compressor: the header fields, PLTE, tRNS and the filtered stream.
+static void candidate_hash(const pngz_t *png, size_t insize, uint64_t out[2]) {
+    const uint32_t header[4] = {
+        png->width, png->height, png->bit_depth, png->color_type
+    };
+    hash128(header, sizeof(header), 0, out);
+    if(png->plte_size != 0) {
+        hash128(png->plte, png->plte_size, out[0], out);
+    }
+    if(png->trns_size != 0) {
+        hash128(png->trns, png->trns_size, out[0] ^ 1, out);
+    }
+    hash128(png->filtered, insize, out[0], out);
+}
+
+// Records the hash, returning whether it was seen before.
+static bool seen_before(pngz_t *png, const uint64_t hash[2]) {
+    size_t i;
+    for(i=0;i<png->candidate_hashes_size;i++) {
+        if(!memcmp(png->candidate_hashes[i], hash, sizeof(uint64_t[2]))) {
+            return true;
+        }
+    }
+    if(png->candidate_hashes_size == png->candidate_hashes_capacity) {
+        png->candidate_hashes_capacity = png->candidate_hashes_capacity ?
+                                         png->candidate_hashes_capacity*2 : 16;
+        png->candidate_hashes = realloc(png->candidate_hashes,
+            sizeof(uint64_t[2])*png->candidate_hashes_capacity);
+    }
+    memcpy(png->candidate_hashes[png->candidate_hashes_size++], hash,
+           sizeof(uint64_t[2]));
+    return false;
+}
 
-    ZopfliZlibCompress(
-        &zopfli_options,
-        (unsigned char *)in,
-        insize,
-        (unsigned char **)&(png->idat),
-        &(png->idat_size)
-    );
+// The fast tier: the smallest of zlib's outputs over its parameter grid.
+static void compress_zlib(pngz_t *png, size_t insize, const char *strategy,
+                          void(*callback)(pngz_t*)) {
+    zlib_params params;
+    const double start = monotonic_seconds();
+    png->idat_size = zlib_sweep(png->filtered, insize, png->options->threads,
+                                &png->idat, &params);
+    if(!png->idat) {
+        return;
+    }
+    trace_event(png->trace, "compress", monotonic_seconds() - start,
+                png->idat_size,
+                "\"color_type\":%d,\"bit_depth\":%d,\"filter\":\"%s\","
+                "\"compressor\":\"zlib\",\"level\":%d,\"mem_level\":%d,"
+                "\"window_bits\":%d,\"strategy\":\"%s\"",
+                png->color_type, png->bit_depth, strategy, params.level,
+                params.mem_level, params.window_bits,
+                zlib_strategy_name(params.strategy));
     callback(png);
 
     free(png->idat);
+    png->idat = NULL;
     png->idat_size = 0;
-}
\ No newline at end of file
+}
+
+static void compress_zopfli(pngz_t *png, size_t insize, const char *strategy,
+                            void(*callback)(pngz_t*)) {
+    const effort_preset *effort = png->effort;
+    ZopfliOptions options;
+    ZopfliInitOptions(&options);
+    options.numiterations = effort->iterations;
+    options.blocksplitting = effort->split != SPLIT_NONE;
+    options.blocksplittinglast = effort->split == SPLIT_LAST;
+    options.blocksplittingmax = effort->split_max;
+
+    // Under a deadline each candidate may use half of the time that is left,
+    // which gives the most promising ones, tried first, the most iterations.
+    stop_clock clock = {0, false};
+    if(png->deadline != 0) {
+        const double now = monotonic_seconds();
+        clock.time = now + (png->deadline - now) / 2;
+        options.stop = &past_time;
+        options.stop_context = &clock;
+    }
+
+    options.cachemaxblocksize = png->zopfli_cache_max;
+
+    // SPLIT_BOTH compresses twice, splitting first and then last, and lets
+    // the callback keep whichever is smaller.
+    const int runs = effort->split == SPLIT_BOTH ? 2 : 1;
+    int run;
+    for(run=0;run<runs;run++) {
+        if(run == 1) {
+            if(png->deadline != 0 &&
+               png->deadline - monotonic_seconds() <= png->candidate_floor) {
+                png->iterations_cut = true;
+                break;
+            }
+            options.blocksplittinglast = 1;
+        }
+        phase_times times = {0};
+        if(png->trace || png->deadline != 0) {
+            options.phase = &enter_phase;
+            options.phase_context = &times;
+        }
+
+        const double start = monotonic_seconds();
+        ZopfliZlibCompress(
+            &options,
+            png->filtered,
+            insize,
+            (unsigned char **)&(png->idat),
+            &(png->idat_size)
+        );
+        const double end = monotonic_seconds();
+        end_phase(&times, end);
+        trace_event(png->trace, "compress", end - start, png->idat_size,
+                    "\"color_type\":%d,\"bit_depth\":%d,\"filter\":\"%s\","
+                    "\"compressor\":\"zopfli\",\"split\":\"%s\","
+                    "\"blocksplit\":%.6f,\"greedy\":%.6f,\"squeeze\":%.6f,"
+                    "\"encode\":%.6f,\"squeeze_runs\":%d",
+                    png->color_type, png->bit_depth, strategy,
+                    !options.blocksplitting ? "none" :
+                    options.blocksplittinglast ? "last" : "first",
+                    times.blocksplit, times.greedy, times.squeeze, times.encode,
+                    times.squeeze_runs);
+        if(png->deadline != 0 && png->candidate_floor == 0) {
+            png->candidate_floor = times.blocksplit + times.greedy +
+                                   times.encode;
+            if(times.squeeze_runs > 0) {
+                png->candidate_floor += times.squeeze * times.greedy_runs /
+                                        times.squeeze_runs;
+            }
+        }
+        callback(png);
+
+        free(png->idat);
+        png->idat = NULL;
+        png->idat_size = 0;
+    }
+    if(clock.stopped) {
+        png->iterations_cut = true;
+    }
+}
+
+void compress(pngz_t *png, const filter_candidate *candidate,
+              void(*callback)(pngz_t*)) {
+
+    png->idat = NULL;
+    png->idat_size = 0;
+
+    // Once the time left is less than the first candidate needed to give a
+    // result, only that first candidate is still compressed, so there is
+    // always one.
+    if(png->deadline != 0 && png->candidates_compressed > 0 &&
+       png->deadline - monotonic_seconds() <= png->candidate_floor) {
+        png->deadline_reached = true;
+        return;
+    }
+
+    const double start = monotonic_seconds();
+    const size_t insize = filter_materialize(png, candidate);
+    png->filter_strategy = candidate->strategy;
+
+    // A candidate identical to an earlier one compresses to the same file,
+    // which was already considered.
+    uint64_t hash[2];
+    candidate_hash(png, insize, hash);
+    const bool duplicate = seen_before(png, hash);
+    trace_event(png->trace, "filter", monotonic_seconds() - start, insize,
+                "\"filter\":\"%s\",\"duplicate\":%s",
+                candidate->strategy, duplicate ? "true" : "false");
+    if(duplicate) {
+        png->candidates_skipped++;
+        return;
+    }
+    png->candidates_compressed++;
+
+    if(png->effort->compressor == COMPRESS_ZLIB) {
+        compress_zlib(png, insize, candidate->strategy, callback);
+    }
+    else {
+        compress_zopfli(png, insize, candidate->strategy, callback);
+    }
+}
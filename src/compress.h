@@ -2,7 +2,9 @@
 #define PNGZ_COMPRESS_H_
 
 #include "pngz.h"
+#include "filter.h"
 
-void compress(pngz_t *png, void *in, size_t insize, void(*callback)(pngz_t*));
+void compress(pngz_t *png, const filter_candidate *candidate,
+              void(*callback)(pngz_t*));
 
 #endif
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "effort.h"
+#include "libpngz.h"
+
+#include <stddef.h>
+
+// Measured with pngz-bench on corpus/ plus "pngz-gencorpus --size 256x256",
+// totals over the 20 images:
+//
+//   level  output bytes  CPU seconds
+//   -o0    174211          2.5
+//   -o1    159358         10.2
+//   -o2    158846         27.3
+//   -o3    150331         49.4
+//   -o4    144628         85.6
+//   -o5    144545        171.1
+//   -o6    144501        519.2
+//
+// 0 is the zlib tier, for when time matters more than bytes. 1 spends part of
+// its time ranking encodings by their zlib size, which picks the one it tries
+// better than entropy does; at 2, trying a second encoding makes up for it.
+// The five single filters account for most of the step from 3 to 4; past 4,
+// iterations buy little. 4 is what pngz always did before levels existed.
+static const effort_preset presets[PNGZ_MAX_EFFORT + 1] = {
+    {1, 0,   ESTIMATE_ENTROPY,  COMPRESS_ZLIB,   1, 0,  SPLIT_NONE,  0},
+    {1, 0,   ESTIMATE_DEFLATED, COMPRESS_ZOPFLI, 1, 5,  SPLIT_FIRST, 15},
+    {2, 2.0, ESTIMATE_FILTERED, COMPRESS_ZOPFLI, 2, 10, SPLIT_FIRST, 15},
+    {0, 2.0, ESTIMATE_FILTERED, COMPRESS_ZOPFLI, 3, 15, SPLIT_FIRST, 15},
+    {0, 2.0, ESTIMATE_FILTERED, COMPRESS_ZOPFLI, 6, 15, SPLIT_FIRST, 15},
+    {0, 4.0, ESTIMATE_FILTERED, COMPRESS_ZOPFLI, 6, 30, SPLIT_FIRST, 15},
+    {0, 0,   ESTIMATE_FILTERED, COMPRESS_ZOPFLI, 6, 60, SPLIT_BOTH,  15}
+};
+
+// The preset for a level, or NULL if there is no such level.
+const effort_preset* effort_preset_get(int level) {
+    if(level < 0 || level > PNGZ_MAX_EFFORT) {
+        return NULL;
+    }
+    return &presets[level];
+}
@@ -0,0 +1,47 @@
+#ifndef PNGZ_EFFORT_H_
+#define PNGZ_EFFORT_H_
+
+#include <stdbool.h>
+
+// How an effort level (pngz -o<n>) spends its time. Levels run from 0,
+// quickest, to PNGZ_MAX_EFFORT, the most exhaustive.
+
+// How encodings and transparent pixel fills are weighed against each other.
+typedef enum estimator_e {
+    ESTIMATE_ENTROPY,  // Sample entropy only, which can't tell fills apart:
+                       // transparent pixels are left as loaded
+    ESTIMATE_FILTERED, // Fills ranked by filtering and entropy coding them
+    ESTIMATE_DEFLATED  // As ESTIMATE_FILTERED, then every encoding ranked by
+                       // its heuristically filtered zlib_sweep size
+} estimator;
+
+typedef enum compressor_e {
+    COMPRESS_ZOPFLI,
+    COMPRESS_ZLIB      // zlib_sweep
+} compressor;
+
+typedef enum split_mode_e {
+    SPLIT_NONE,   // One deflate block
+    SPLIT_FIRST,  // Zopfli splits, then optimizes each block
+    SPLIT_LAST,   // Zopfli optimizes, then splits
+    SPLIT_BOTH    // Both, keeping the smaller
+} split_mode;
+
+typedef struct effort_preset_s {
+    int color_types;          // Most encodings tried, best estimate first,
+                              // 0 for all
+    double prune_ratio;       // Skip encodings estimated larger than the
+                              // best by this factor, 0 to try them all
+    estimator estimator;
+    compressor compressor;
+    int filters;              // Filter candidates per encoding: the heuristic,
+                              // then up to 5 single filters
+    // Zopfli only
+    int iterations;
+    split_mode split;
+    int split_max;            // Most blocks it splits into
+} effort_preset;
+
+const effort_preset* effort_preset_get(int level);
+
+#endif
@@ -1,5 +1,7 @@
 #include "pngz.h"
 #include "filter.h"
+#include "helpers.h"
+#include "zlib_sweep.h"
 
 #include <stdio.h>
 #include <time.h>
@@ -7,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <stdbool.h>
 
 /* Return size in bits of the pixels in this pngz_t based on
  * its color type and bit depth.
@@ -50,209 +53,306 @@ int get_filtered_size(pngz_t *png) {
     return get_filtered_bytes_per_row(png) * png->height;
 }
 
-uint8_t** pre_filter_data(pngz_t *png, const uint8_t *unfiltered) {
-    int i,j;
-    const int num_rows = png->height;
-    const int unfiltered_row_size = get_unfiltered_bytes_per_row(png);
-    const uint8_t bytes_per_pixel = (get_bits_per_pixel(png) + 7)/8;
-
-    // Filtered data has one byte at the front of each row
-    // to specify the filter type.
-    const size_t filtered_size = num_rows*(unfiltered_row_size+1);
-
-    // Malloc memory for pre-filtered data
-    uint8_t **prefiltered = malloc(5 * sizeof(uint8_t *));
-    for(i=0;i<5;i++)
-    {
-        prefiltered[i] = malloc(filtered_size * sizeof(uint8_t));
-    }
-
-    // Pre-filter every row
-    for(i=0;i<num_rows;i++) // row loop
-    {
-        int unfiltered_row_offset = i*unfiltered_row_size;
-        int prefiltered_row_offset = i*(unfiltered_row_size+1);
-
-        // Write filter-type byte for this row.
-        prefiltered[0][prefiltered_row_offset] = 0; // 0: None
-        prefiltered[1][prefiltered_row_offset] = 1; // 1: Sub
-        prefiltered[2][prefiltered_row_offset] = 2; // 2: Up
-        prefiltered[3][prefiltered_row_offset] = 3; // 3: Avg
-        prefiltered[4][prefiltered_row_offset] = 4; // 4: Paeth
-
-        // Copy entire row for filter type 0.
-        memcpy(prefiltered[0]+prefiltered_row_offset+1,
-               unfiltered+unfiltered_row_offset,
-               unfiltered_row_size);
-        
-        // Filter each individual byte.
-        for(j=0;j<unfiltered_row_size;j++)
-        {
-            int unfiltered_byte_index = unfiltered_row_offset+j;
-            int prefiltered_byte_index = prefiltered_row_offset+j+1;
-
-            uint8_t raw = unfiltered[unfiltered_byte_index]; // Original value
-
-            // Get values of up, left, and up_left: each is needed for the
-            // various filter calculations.
-            uint8_t left, up, up_left;
-
-            // Set `up` to be the value of the byte directly above the current,
-            // imagining unfiltered as two dimensional (row_size x height).
-            // If we're in the first row, set it to zero.
-            if(i > 0) {
-                up = unfiltered[unfiltered_byte_index - unfiltered_row_size];
-            }
-            else {
-                up = 0;
-            }
-
-            // Set `left` to be the value of the byte `bytes_per_pixel` to the
-            // left. If that's beyond the first column, set it to zero.
-            if(j >= bytes_per_pixel) {
-                left = unfiltered[unfiltered_byte_index - bytes_per_pixel];
-            }
-            else {
-                left = 0;
-            }
-
-            // Combination of up and left: the byte one row up and
-            // `bytes_per_pixel` to the left.
-            if(i > 0 && j >= bytes_per_pixel) {
-                up_left = unfiltered[unfiltered_byte_index -
-                                    (unfiltered_row_size + bytes_per_pixel)];
-            }
-            else {
-                up_left = 0;
+/* Applies PNG filter `type` to one unfiltered row. `prev` is the unfiltered
+ * row above it, or NULL for the first row.
+ */
+static void filter_row(int type, const uint8_t *row, const uint8_t *prev,
+                       size_t row_size, size_t bytes_per_pixel, uint8_t *out) {
+    size_t j;
+    for(j=0;j<row_size;j++) {
+        const int left = j >= bytes_per_pixel ? row[j - bytes_per_pixel] : 0;
+        const int up = prev ? prev[j] : 0;
+        const int up_left = prev && j >= bytes_per_pixel ?
+                            prev[j - bytes_per_pixel] : 0;
+        int predictor;
+        switch(type) {
+            case 1: predictor = left; break;
+            case 2: predictor = up; break;
+            case 3: predictor = (left + up) / 2; break;
+            case 4: {
+                const int p = left + up - up_left;
+                const int pa = abs(p - left);
+                const int pb = abs(p - up);
+                const int pc = abs(p - up_left);
+                if(pa <= pb && pa <= pc) predictor = left;
+                else if(pb <= pc) predictor = up;
+                else predictor = up_left;
+                break;
             }
-
-            // Calculate individual filtered values.
-
-            // 1: Sub
-            prefiltered[1][prefiltered_byte_index] = (raw - left) % 256;
-            // 2: Up
-            prefiltered[2][prefiltered_byte_index] = (raw - up) % 256;
-            // 3: Avg
-            const int avg = (raw-(int)floor((left+up)/2.0))%256;
-            prefiltered[3][prefiltered_byte_index] = avg;
-            // 4: Paeth
-            int p = left + up - up_left;
-            int pa, pb, pc, paeth;
-            pa = abs(p - left);
-            pb = abs(p - up);
-            pc = abs(p - up_left);
-            if(pa <= pb && pa <= pc)
-                paeth = left;
-            else if(pb <= pc)
-                paeth = up;
-            else
-                paeth = up_left;
-            prefiltered[4][prefiltered_byte_index] = (raw - paeth) % 256;
+            default: predictor = 0; break;
         }
+        out[j] = (uint8_t)(row[j] - predictor);
     }
-    return prefiltered;
 }
 
-void smart_filter(pngz_t *png,
-                  uint8_t **prefiltered,
-                  void(*callback)(pngz_t*, void*, size_t)) {
+/* Writes row `y` of the image filtered with `type` into `out`, which gets the
+ * filter type byte followed by the filtered row.
+ */
+static void filter_image_row(pngz_t *png, const uint8_t *unfiltered, size_t y,
+                             int type, uint8_t *out) {
+    const size_t row_size = get_unfiltered_bytes_per_row(png);
+    const size_t bytes_per_pixel = (get_bits_per_pixel(png) + 7)/8;
+    const uint8_t *row = unfiltered + y*row_size;
+    const uint8_t *prev = y > 0 ? row - row_size : NULL;
+    out[0] = type;
+    filter_row(type, row, prev, row_size, bytes_per_pixel, out + 1);
+}
 
-    unsigned int i,j,k;
+/* Picks for every row the filter whose output has the smallest sum of
+ * absolute values, counting the filter type byte. Only the five candidates
+ * of the current row are held at a time.
+ */
+static void choose_row_filters(pngz_t *png, const uint8_t *unfiltered,
+                               uint8_t *row_filters, size_t totals[5]) {
     const size_t filtered_row_size = get_filtered_bytes_per_row(png);
-    const size_t filtered_size = filtered_row_size * png->height;
+    uint8_t *band = malloc(5 * filtered_row_size);
+    unsigned int i, j, k;
 
-    callback(png, (void *)prefiltered[0], filtered_size);
-    callback(png, (void *)prefiltered[1], filtered_size);
-    callback(png, (void *)prefiltered[2], filtered_size);
-    callback(png, (void *)prefiltered[3], filtered_size);
-    callback(png, (void *)prefiltered[4], filtered_size);
-
-    uint8_t *filtered = malloc(filtered_size);
-    
+    memset(totals, 0, 5 * sizeof(size_t));
     for(i=0;i<png->height;i++) {
-        int offset = i * filtered_row_size;
-        int row_sums[5];
+        int smallest_idx = 0;
+        int smallest = 0;
         for(j=0;j<5;j++) {
+            uint8_t *candidate = band + j*filtered_row_size;
             int row_sum = 0;
+            filter_image_row(png, unfiltered, i, j, candidate);
             for(k=0;k<filtered_row_size;k++) {
-                row_sum += abs((int8_t)prefiltered[j][offset + k]);
+                row_sum += abs((int8_t)candidate[k]);
             }
-            row_sums[j] = row_sum;
-        }
-        int smallest_idx = 0;
-        int smallest = row_sums[0];
-        for(j=1;j<5;j++) {
-            if(row_sums[j] < smallest) {
-                smallest = row_sums[j];
+            totals[j] += row_sum;
+            if(j == 0 || row_sum < smallest) {
+                smallest = row_sum;
                 smallest_idx = j;
             }
         }
-        memcpy(filtered+offset, prefiltered[smallest_idx]+offset,
-               filtered_row_size);
+        row_filters[i] = smallest_idx;
     }
-    
-    callback(png, (void *)filtered, filtered_size);
-    free(filtered);
+    free(band);
 }
 
-void brute_force_filter(pngz_t *png,
-                        uint8_t **prefiltered,
-                        void(*callback)(pngz_t*, void*, size_t)) {
-
-    const int num_rows = png->height;
+/* Makes png->filtered hold the candidate's filtered stream and returns its
+ * size. The buffer is reused across candidates, and rows whose filter is the
+ * same as in the stream it already holds are left alone, so consecutive
+ * candidates that differ in a few rows cost only those rows.
+ */
+size_t filter_materialize(pngz_t *png, const filter_candidate *candidate) {
+    const size_t filtered_size = get_filtered_size(png);
     const size_t filtered_row_size = get_filtered_bytes_per_row(png);
-    const size_t filtered_size = filtered_row_size * num_rows;
+    const bool reuse = png->filtered_source == candidate->unfiltered;
+    size_t y;
+
+    if(png->filtered_capacity < filtered_size) {
+        free(png->filtered);
+        free(png->filtered_row_filters);
+        png->filtered = malloc(filtered_size);
+        png->filtered_row_filters = malloc(png->height);
+        png->filtered_capacity = filtered_size;
+        png->filtered_source = NULL;
+    }
 
-    int i;
+    for(y=0;y<png->height;y++) {
+        if(reuse && png->filtered_row_filters[y] == candidate->row_filters[y]) {
+            continue;
+        }
+        filter_image_row(png, candidate->unfiltered, y,
+                         candidate->row_filters[y],
+                         png->filtered + y*filtered_row_size);
+        png->filtered_row_filters[y] = candidate->row_filters[y];
+    }
+    png->filtered_source = candidate->unfiltered;
+    return filtered_size;
+}
+
+/* Size of the unfiltered data filtered as smart_filter's heuristic would and
+ * deflated by zlib_sweep: a quick stand-in for what zopfli makes of it.
+ */
+size_t filter_deflated_size(pngz_t *png, const uint8_t *unfiltered) {
+    uint8_t *row_filters = malloc(png->height);
+    size_t totals[5];
+    filter_candidate candidate;
+    candidate.unfiltered = unfiltered;
+    candidate.row_filters = row_filters;
+    candidate.strategy = "heuristic";
+    choose_row_filters(png, unfiltered, row_filters, totals);
+
+    // The data is freed after this, and the next image data may land at
+    // the same address.
+    png->filtered_source = NULL;
+    const size_t insize = filter_materialize(png, &candidate);
+    png->filtered_source = NULL;
+
+    uint8_t *out;
+    const size_t size = zlib_sweep(png->filtered, insize,
+                                   png->options->threads, &out, NULL);
+    free(out);
+    free(row_filters);
+    return size;
+}
+
+void smart_filter(pngz_t *png,
+                  const uint8_t *unfiltered,
+                  void(*callback)(pngz_t*, const filter_candidate*)) {
+
+    uint8_t *row_filters = malloc(png->height);
+    filter_candidate candidate;
+    candidate.unfiltered = unfiltered;
+    candidate.row_filters = row_filters;
+    static const char *names[5] = {"none", "sub", "up", "average", "paeth"};
+    size_t totals[5];
+    int order[5];
+    int i, j;
+
+    // Heuristic choice per row.
+    const double start = monotonic_seconds();
+    choose_row_filters(png, unfiltered, row_filters, totals);
+    trace_event(png->trace, "choose_filters", monotonic_seconds() - start,
+                get_filtered_size(png), NULL);
+    candidate.strategy = "heuristic";
+    callback(png, &candidate);
+
+    // The five filters on their own, smallest sum of absolute values first,
+    // so that a time budget or a lower effort goes to the likeliest winners.
+    for(i=0;i<5;i++) {
+        for(j=i;j>0 && totals[order[j-1]] > totals[i];j--) {
+            order[j] = order[j-1];
+        }
+        order[j] = i;
+    }
+    for(i=0;i<5 && i+1<png->effort->filters;i++) {
+        memset(row_filters, order[i], png->height);
+        candidate.strategy = names[order[i]];
+        callback(png, &candidate);
+    }
+
+    free(row_filters);
+}
 
-    // Malloc & initialize counter to zero
-    uint8_t* counter = calloc(num_rows, sizeof(uint8_t));
+void brute_force_filter(pngz_t *png,
+                        const uint8_t *unfiltered,
+                        void(*callback)(pngz_t*, const filter_candidate*)) {
+
+    const size_t num_rows = png->height;
+    size_t i;
 
-    // Malloc & initialize 'filtered' w/ prefiltered[0]
-    unsigned char* filtered = malloc(filtered_size);
-    memcpy(filtered, prefiltered[0], filtered_size);
+    // Row filter vector, counting through all combinations.
+    uint8_t *row_filters = calloc(num_rows, sizeof(uint8_t));
+    filter_candidate candidate;
+    candidate.unfiltered = unfiltered;
+    candidate.row_filters = row_filters;
+    candidate.strategy = "brute_force";
 
     // Go through all possible filter combinations
     for(;;)
     {
-        // Incr counter and modify 'filtered' appropriately
+        // Incr counter
         for(i=0;i<num_rows;i++)
         {
-            if(counter[i] != 4) // Skip over 4s, as they will be zeroed
+            if(row_filters[i] != 4) // Skip over 4s, as they will be zeroed
             {
-                int offset = i*filtered_row_size;
-                if(i != 0) // zero counter[x] where x < i
-                {
-                    memset(counter, 0, i*sizeof(uint8_t));
-                    memcpy(filtered, prefiltered[0], offset);
-                }
-                counter[i]++;
-                memcpy(filtered+offset, prefiltered[counter[i]]+offset,
-                       filtered_row_size);
+                memset(row_filters, 0, i*sizeof(uint8_t));
+                row_filters[i]++;
                 goto callback;
             }
         }
         goto cleanup;
         callback:
-        callback(png, (void *)filtered, filtered_size);
+        callback(png, &candidate);
     }
     cleanup:
-    free(counter);
-    free(filtered);
+    free(row_filters);
 }
 
-void filter(pngz_t *png,
-//          pngz_options opts, 
-            const void *unfiltered,
-            void(*callback)(pngz_t*, void*, size_t)){
+/* Cheap stand-in for compressing a candidate: every row gets the filter with
+ * the smallest sum of absolute values, as smart_filter's heuristic does, and
+ * the size is the order-0 entropy of the filtered bytes. Rows are fed one at a
+ * time so only two of them are ever held.
+ */
+struct filter_estimator_s {
+    size_t row_size;
+    size_t bytes_per_pixel;
+    size_t rows;
+    uint8_t *prev;
+    uint8_t *filtered[5];
+    size_t histogram[256];
+};
+
+filter_estimator* filter_estimator_create(size_t row_size,
+                                          size_t bytes_per_pixel) {
+    int i;
+    filter_estimator *est = calloc(1, sizeof(filter_estimator));
+    est->row_size = row_size;
+    est->bytes_per_pixel = bytes_per_pixel;
+    est->prev = malloc(row_size);
+    for(i=0;i<5;i++) est->filtered[i] = malloc(row_size);
+    return est;
+}
 
-    uint8_t **prefiltered = pre_filter_data(png, unfiltered);
+void filter_estimator_add_row(filter_estimator *est, const uint8_t *row) {
+    int i;
+    size_t j;
+    int best = 0;
+    unsigned long best_sum = 0;
+    for(i=0;i<5;i++) {
+        unsigned long sum = 0;
+        filter_row(i, row, est->rows ? est->prev : NULL, est->row_size,
+                   est->bytes_per_pixel, est->filtered[i]);
+        for(j=0;j<est->row_size;j++) {
+            sum += abs((int8_t)est->filtered[i][j]);
+        }
+        if(i == 0 || sum < best_sum) {
+            best = i;
+            best_sum = sum;
+        }
+    }
+    est->histogram[best]++; // Filter type byte
+    for(j=0;j<est->row_size;j++) {
+        est->histogram[est->filtered[best][j]]++;
+    }
+    memcpy(est->prev, row, est->row_size);
+    est->rows++;
+}
 
-    smart_filter(png, prefiltered, callback);
-    //brute_force_filter(png, prefiltered, callback);
+/* Estimated compressed size in bytes of the rows added so far.
+ */
+double filter_estimator_size(const filter_estimator *est) {
+    const double total = (double)est->rows * (est->row_size + 1);
+    double bits = 0;
+    int i;
+    for(i=0;i<256;i++) {
+        if(est->histogram[i] != 0) {
+            bits -= est->histogram[i] * log2(est->histogram[i] / total);
+        }
+    }
+    return bits / 8;
+}
 
-    // Cleanup
+void filter_estimator_delete(filter_estimator *est) {
     int i;
-    for(i=0;i<5;i++) free(prefiltered[i]);
-    free(prefiltered);
-}
\ No newline at end of file
+    for(i=0;i<5;i++) free(est->filtered[i]);
+    free(est->prev);
+    free(est);
+}
+
+void filter(pngz_t *png,
+//          pngz_options opts, 
+            const void *unfiltered,
+            void(*callback)(pngz_t*, const filter_candidate*)){
+
+    // Whatever png->filtered holds came from some other unfiltered data.
+    png->filtered_source = NULL;
+
+    // The row filters of a cached result in this encoding go first.
+    if(png->warm_row_filters && png->color_type == png->warm_color_type &&
+       png->bit_depth == png->warm_bit_depth &&
+       png->transparent_fill == png->warm_transparent_fill &&
+       png->color_key == png->warm_color_key) {
+        filter_candidate candidate;
+        candidate.unfiltered = unfiltered;
+        candidate.row_filters = png->warm_row_filters;
+        candidate.strategy = "cached";
+        callback(png, &candidate);
+    }
+
+    smart_filter(png, unfiltered, callback);
+    //brute_force_filter(png, unfiltered, callback);
+}
@@ -2,9 +2,29 @@
 #define PNGZ_FILTER_H_
 
 #include "pngz.h"
+#include <stdint.h>
+
+// A filtered stream, as the unfiltered data and the filter type of each row,
+// with the name of the strategy that chose them.
+typedef struct filter_candidate_s {
+    const uint8_t *unfiltered;
+    const uint8_t *row_filters;
+    const char *strategy;
+} filter_candidate;
 
 void filter(pngz_t *png,
             const void *unfiltered,
-            void(*callback)(pngz_t*, void*, size_t));
+            void(*callback)(pngz_t*, const filter_candidate*));
+
+size_t filter_materialize(pngz_t *png, const filter_candidate *candidate);
+size_t filter_deflated_size(pngz_t *png, const uint8_t *unfiltered);
+
+typedef struct filter_estimator_s filter_estimator;
+
+filter_estimator* filter_estimator_create(size_t row_size,
+                                          size_t bytes_per_pixel);
+void filter_estimator_add_row(filter_estimator*, const uint8_t *row);
+double filter_estimator_size(const filter_estimator*);
+void filter_estimator_delete(filter_estimator*);
 
 #endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include <time.h>
 
 struct counter_s
 {
@@ -54,6 +55,10 @@ int counter_get_last_val(counter* c){
     return c->last_modified_val;
 }
 
+int counter_get(counter* c, unsigned int place){
+    return c->count[place];
+}
+
 uint64_t convert_raw_pixel_to_uint64(const raw_pixel pixel) {
     uint64_t pixel_64 = 0;
     pixel_64 |= (uint64_t)pixel.red << 48;
@@ -82,4 +87,91 @@ uint16_t convert_bit_depth(uint16_t input, uint8_t from, uint8_t to) {
         input >>= (from - to);
     }
     return input;
-}
\ No newline at end of file
+}
+
+static uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static uint64_t fmix64(uint64_t k) {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+// 128 bit MurmurHash3 (x64 variant) of `len` bytes. Chaining several buffers
+// is done by passing the low half of one hash as the seed of the next.
+void hash128(const void *data, size_t len, uint64_t seed, uint64_t out[2]) {
+    const uint8_t *bytes = data;
+    const size_t nblocks = len / 16;
+    const uint64_t c1 = 0x87c37b91114253d5ULL;
+    const uint64_t c2 = 0x4cf5ad432745937fULL;
+    uint64_t h1 = seed;
+    uint64_t h2 = seed;
+    size_t i;
+
+    for(i=0;i<nblocks;i++) {
+        uint64_t k1, k2;
+        memcpy(&k1, bytes + i*16, 8);
+        memcpy(&k2, bytes + i*16 + 8, 8);
+
+        k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+        h1 = rotl64(h1, 27); h1 += h2; h1 = h1*5 + 0x52dce729;
+        k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+        h2 = rotl64(h2, 31); h2 += h1; h2 = h2*5 + 0x38495ab5;
+    }
+
+    const uint8_t *tail = bytes + nblocks*16;
+    uint64_t k1 = 0;
+    uint64_t k2 = 0;
+    switch(len & 15) {
+        case 15: k2 ^= (uint64_t)tail[14] << 48; // fall through
+        case 14: k2 ^= (uint64_t)tail[13] << 40; // fall through
+        case 13: k2 ^= (uint64_t)tail[12] << 32; // fall through
+        case 12: k2 ^= (uint64_t)tail[11] << 24; // fall through
+        case 11: k2 ^= (uint64_t)tail[10] << 16; // fall through
+        case 10: k2 ^= (uint64_t)tail[9] << 8;   // fall through
+        case 9:  k2 ^= (uint64_t)tail[8];
+                 k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+                 // fall through
+        case 8:  k1 ^= (uint64_t)tail[7] << 56;  // fall through
+        case 7:  k1 ^= (uint64_t)tail[6] << 48;  // fall through
+        case 6:  k1 ^= (uint64_t)tail[5] << 40;  // fall through
+        case 5:  k1 ^= (uint64_t)tail[4] << 32;  // fall through
+        case 4:  k1 ^= (uint64_t)tail[3] << 24;  // fall through
+        case 3:  k1 ^= (uint64_t)tail[2] << 16;  // fall through
+        case 2:  k1 ^= (uint64_t)tail[1] << 8;   // fall through
+        case 1:  k1 ^= (uint64_t)tail[0];
+                 k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+    }
+
+    h1 ^= len;
+    h2 ^= len;
+    h1 += h2;
+    h2 += h1;
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+    h1 += h2;
+    h2 += h1;
+
+    out[0] = h1;
+    out[1] = h2;
+}
+
+// Seconds on a clock that only moves forward, for deadlines and timings.
+double monotonic_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// CPU seconds used by the calling thread alone, so concurrent calls in one
+// process, as in pngzd, don't count each other's work.
+double thread_cpu_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
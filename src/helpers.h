@@ -7,6 +7,9 @@
 uint64_t convert_raw_pixel_to_uint64(const raw_pixel pixel);
 int raw_pixel_cmp(const raw_pixel px1, const raw_pixel px2);
 uint16_t convert_bit_depth(uint16_t input, uint8_t from, uint8_t to);
+void hash128(const void *data, size_t len, uint64_t seed, uint64_t out[2]);
+double monotonic_seconds(void);
+double thread_cpu_seconds(void);
 
 typedef struct counter_s counter;
 
@@ -15,5 +18,6 @@ void counter_delete(counter*);
 int counter_incr(counter*);
 int counter_get_last_idx(counter*);
 int counter_get_last_val(counter*);
+int counter_get(counter*, unsigned int place);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,239 @@
+#include "libpngz.h"
+#include "pngz.h"
+#include "load.h"
+#include "colortypes.h"
+#include "filter.h"
+#include "compress.h"
+#include "save.h"
+#include "helpers.h"
+#include "cache.h"
+#include "memory.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+static void colortype_callback(pngz_t*, void*);
+static void filter_callback(pngz_t*, const filter_candidate*);
+static void compress_callback(pngz_t*);
+static size_t compute_output_size(const pngz_t*);
+
+void pngz_params_init(pngz_params *params) {
+    params->cache_dir = NULL;
+    params->trace_filename = NULL;
+    params->name = "";
+    params->time_budget = 0;
+    params->effort = PNGZ_DEFAULT_EFFORT;
+    params->threads = 1;
+    params->force = false;
+    params->verbose = false;
+    params->stats = NULL;
+}
+
+const char* pngz_strerror(pngz_status status) {
+    switch(status) {
+        case PNGZ_OK: return "success";
+        case PNGZ_ERROR_PARAMS: return "invalid arguments";
+        case PNGZ_ERROR_DECODE: return "input is not a readable PNG";
+        case PNGZ_ERROR_IO: return "trace file could not be opened";
+    }
+    return "unknown error";
+}
+
+void pngz_free(void *buffer) {
+    free(buffer);
+}
+
+static void init_png(pngz_t *png, const pngz_params *params,
+                     const void *in, size_t in_len, double start) {
+    png->options = params;
+    png->effort = effort_preset_get(params->effort);
+    png->input = in;
+    png->original_size = in_len;
+    png->best_size = in_len;
+    png->best_png = NULL;
+    png->raw_pixels = NULL;
+
+    png->plte_size = 0;
+    png->trns_size = 0;
+    png->filtered = NULL;
+    png->filtered_capacity = 0;
+    png->filtered_source = NULL;
+    png->filtered_row_filters = NULL;
+    png->candidate_hashes = NULL;
+    png->candidate_hashes_size = 0;
+    png->candidate_hashes_capacity = 0;
+    png->candidates_compressed = 0;
+    png->candidates_skipped = 0;
+    png->best_row_filters = NULL;
+    png->passed_through = false;
+    png->best_color_type = 0;
+    png->best_bit_depth = 0;
+    png->best_transparent_fill = 0;
+    png->best_color_key = false;
+    png->best_filter_strategy = NULL;
+    png->warm_row_filters = NULL;
+    png->deflated_estimate = 0;
+    png->start_time = start;
+    png->deadline = params->time_budget > 0 ? start + params->time_budget : 0;
+    png->deadline_reached = false;
+    png->iterations_cut = false;
+    png->candidate_floor = 0;
+    png->memory_reserved = 0;
+    png->memory_mode = MEMORY_FULL;
+    png->zopfli_cache_max = 0;
+    png->trace = NULL;
+}
+
+static void free_png(pngz_t *png) {
+    free(png->raw_pixels);
+    free(png->filtered);
+    free(png->filtered_row_filters);
+    free(png->candidate_hashes);
+    free(png->best_row_filters);
+    free(png->warm_row_filters);
+    free(png->best_png);
+    trace_close(png->trace);
+    memory_release(png);
+}
+
+pngz_status pngz_optimize(const void *in, size_t in_len,
+                          void **out, size_t *out_len,
+                          const pngz_params *params) {
+
+    const double start = monotonic_seconds();
+    const double cpu_start = thread_cpu_seconds();
+    pngz_params defaults;
+    if(!params) {
+        pngz_params_init(&defaults);
+        params = &defaults;
+    }
+    if(!in || !out || !out_len || !effort_preset_get(params->effort)) {
+        return PNGZ_ERROR_PARAMS;
+    }
+
+    pngz_t png;
+    init_png(&png, params, in, in_len, start);
+    if(params->trace_filename) {
+        png.trace = trace_open(params->trace_filename,
+                               params->name ? params->name : "");
+        if(!png.trace) {
+            return PNGZ_ERROR_IO;
+        }
+    }
+
+    memory_admit(&png);
+
+    double stage_start = monotonic_seconds();
+    pngz_status status = load_png(&png);
+    if(status != PNGZ_OK) {
+        free_png(&png);
+        return status;
+    }
+    trace_event(png.trace, "load", monotonic_seconds() - stage_start,
+                png.original_size, NULL);
+
+    stage_start = monotonic_seconds();
+    const bool hit = cache_lookup(&png);
+    trace_event(png.trace, "cache_lookup", monotonic_seconds() - stage_start,
+                0, "\"hit\":%s", hit ? "true" : "false");
+    if(!hit && !png.passed_through) {
+        colortype_dispatch(&png, &colortype_callback);
+        if(!png.deadline_reached && !png.iterations_cut &&
+           png.memory_mode != MEMORY_MINIMAL) {
+            // A search cut short, or without some candidates, is not the
+            // result the options stand for.
+            cache_store(&png);
+        }
+    }
+
+    // The caller always gets a valid PNG: the input if nothing beat it.
+    if(png.best_png) {
+        *out = png.best_png;
+        png.best_png = NULL;
+    }
+    else {
+        *out = malloc(in_len);
+        memcpy(*out, in, in_len);
+    }
+    *out_len = png.best_size;
+
+    const double seconds = monotonic_seconds() - start;
+    // The calling thread's CPU time only: the zlib tier's sweep helper
+    // threads are not counted.
+    const double cpu_seconds = thread_cpu_seconds() - cpu_start;
+    trace_event(png.trace, "result", seconds, png.best_size,
+                "\"original_size\":%zu,\"cpu_seconds\":%.6f,"
+                "\"outcome\":\"%s\",\"color_type\":%d,\"bit_depth\":%d,"
+                "\"filter\":\"%s\",\"candidates\":%zu,\"effort\":%d",
+                png.original_size, cpu_seconds,
+                hit ? "cache_hit" : png.passed_through ? "passed_through" :
+                png.best_size < png.original_size ? "improved" : "unimproved",
+                png.best_color_type, png.best_bit_depth,
+                png.best_filter_strategy ? png.best_filter_strategy : "",
+                png.candidates_compressed, params->effort);
+
+    pngz_stats *stats = params->stats;
+    if(stats) {
+        stats->original_size = png.original_size;
+        stats->optimized_size = png.best_size;
+        stats->candidates = png.candidates_compressed;
+        stats->duplicates_skipped = png.candidates_skipped;
+        stats->improved = png.best_size < png.original_size;
+        stats->cache_hit = hit;
+        stats->passed_through = png.passed_through;
+        stats->deadline_reached = png.deadline_reached || png.iterations_cut;
+        stats->memory_reduced = png.memory_mode != MEMORY_FULL;
+        stats->seconds = seconds;
+    }
+
+    free_png(&png);
+    return PNGZ_OK;
+}
+
+// callback passed to colortype methods
+static void colortype_callback(pngz_t *png, void *unfiltered) {
+    filter(png, unfiltered, &filter_callback);
+}
+
+// callback passed to filter method
+static void filter_callback(pngz_t *png, const filter_candidate *candidate) {
+    compress(png, candidate, &compress_callback);
+}
+
+// callback passed to compress method
+static void compress_callback(pngz_t *png) {
+    size_t output_size = compute_output_size(png);
+    if(output_size < png->best_size) {
+        const double start = monotonic_seconds();
+        save_png(png, output_size);
+        trace_event(png->trace, "save", monotonic_seconds() - start,
+                    output_size, NULL);
+        png->best_size = output_size;
+        png->best_color_type = png->color_type;
+        png->best_bit_depth = png->bit_depth;
+        png->best_transparent_fill = png->transparent_fill;
+        png->best_color_key = png->color_key;
+        png->best_filter_strategy = png->filter_strategy;
+        if(!png->best_row_filters) {
+            png->best_row_filters = malloc(png->height);
+        }
+        memcpy(png->best_row_filters, png->filtered_row_filters, png->height);
+    }
+}
+
+static size_t compute_output_size(const pngz_t *png) {
+    size_t output_size = 0;
+    output_size += (8 + 25 + 12); // Signature + IHDR + IEND
+
+    // Chunks have 12 bytes overhead (4 length, 4 type, 4 crc)
+    output_size += png->idat_size + 12;
+    if(png->plte_size > 0) {
+        output_size += png->plte_size + 12;
+    }
+    if(png->trns_size > 0) {
+        output_size += png->trns_size + 12;
+    }
+    return output_size;
+}
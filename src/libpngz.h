@@ -0,0 +1,71 @@
+#ifndef LIBPNGZ_H_
+#define LIBPNGZ_H_
+
+// libpngz: the pngz optimizer as a library working on in-memory buffers.
+// Calls share no state, so any number may run at once on different threads.
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Effort levels, pngz_params.effort: 0 is quickest, PNGZ_MAX_EFFORT the most
+// exhaustive.
+#define PNGZ_DEFAULT_EFFORT 4
+#define PNGZ_MAX_EFFORT 6
+
+typedef enum pngz_status_e {
+    PNGZ_OK = 0,
+    PNGZ_ERROR_PARAMS,  // in, out or out_len was NULL, or no such effort
+    PNGZ_ERROR_DECODE,  // The input isn't a PNG libpng can read
+    PNGZ_ERROR_IO       // The trace file couldn't be opened
+} pngz_status;
+
+// Filled in by pngz_optimize when pngz_params.stats isn't NULL.
+typedef struct pngz_stats_s {
+    size_t original_size;
+    size_t optimized_size;
+    size_t candidates;          // Candidates compressed
+    size_t duplicates_skipped;  // Candidates identical to earlier ones
+    bool improved;              // Smaller than the input
+    bool cache_hit;
+    bool passed_through;        // Input judged already optimized
+    bool deadline_reached;      // time_budget cut the search short
+    bool memory_reduced;        // Searched in a lower memory mode to fit the
+                                // memory budget
+    double seconds;             // Wall time
+} pngz_stats;
+
+typedef struct pngz_params_s {
+    const char *cache_dir;       // Reuse and record results here, or NULL;
+                                 // must exist, else nothing is cached
+    const char *trace_filename;  // Append per-stage timings here, or NULL
+    const char *name;            // Name of the image in the trace
+    double time_budget;          // Seconds, 0 for none. Best effort: the
+                                 // first candidate's greedy pass and
+                                 // encoding always run
+    int effort;                  // 0 to PNGZ_MAX_EFFORT
+    int threads;                 // Threads each zlib tier sweep may use,
+                                 // the calling one included (default 1)
+    bool force;                  // Search even if the input looks optimized
+    bool verbose;                // Print progress to stdout
+    pngz_stats *stats;           // Where to report on the run, or NULL
+} pngz_params;
+
+void pngz_params_init(pngz_params *params);
+
+// Optimizes the PNG in in, with the defaults if params is NULL. On success
+// *out is a buffer for pngz_free holding the smallest PNG found, or a copy of
+// the input if nothing beat it.
+pngz_status pngz_optimize(const void *in, size_t in_len,
+                          void **out, size_t *out_len,
+                          const pngz_params *params);
+
+// Caps the memory all pngz_optimize calls in the process take at once, by
+// their estimated peak footprint. Calls wait until theirs fits, and images
+// too large for the cap alone are searched in lower memory modes. 0, the
+// default, for no cap.
+void pngz_set_memory_budget(size_t bytes);
+
+void pngz_free(void *buffer);
+const char* pngz_strerror(pngz_status status);
+
+#endif
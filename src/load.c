@@ -3,60 +3,70 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
-#include <stdio.h>
 #include <stdbool.h>
 
-// Loads png from png->options->input_filename,
+// libpng read callback serving the input buffer.
+typedef struct input_reader_s {
+    const uint8_t *data;
+    size_t size;
+    size_t offset;
+} input_reader;
+
+static void read_input(png_structp png_ptr, png_bytep out, png_size_t size) {
+    input_reader *reader = png_get_io_ptr(png_ptr);
+    if(reader->size - reader->offset < size) {
+        png_error(png_ptr, "Read past the end of the input");
+    }
+    memcpy(out, reader->data + reader->offset, size);
+    reader->offset += size;
+}
+
+// libpng error and warning handlers: failures become a status, not output.
+static void read_error(png_structp png_ptr, png_const_charp message) {
+    (void)message;
+    png_longjmp(png_ptr, 1);
+}
+
+static void read_warning(png_structp png_ptr, png_const_charp message) {
+    (void)png_ptr;
+    (void)message;
+}
+
+// Decodes png->input (original_size bytes long),
 // converts all pixels to 16 bit rgba and fills in
 // the passed pngz_t's raw_pixels field with them.
-// Also fills in width, height, original size, and
-// sets best_size to be original_size.
-
-void load_png(pngz_t *png) {
+// Also fills in width, height, and sets best_size
+// to be original_size. Also notes whether
+// the file looks like pngz output.
 
-    char *file_name = png->options->input_filename;
+pngz_status load_png(pngz_t *png) {
 
-    size_t original_size, width, height, bytes_per_pixel, bytes_per_row;
+    size_t width, height, bytes_per_pixel, bytes_per_row;
 
     int png_transforms = PNG_TRANSFORM_GRAY_TO_RGB | PNG_TRANSFORM_EXPAND_16;
     png_structp png_ptr;
     png_infop info_ptr;
-    png_bytep *row_pointers;    
+    png_bytep *row_pointers;
+    input_reader reader = {png->input, png->original_size, 0};
 
-    FILE *fp = fopen(file_name, "rb");
-    if (!fp) {
-        printf("File '%s' could not be opened\r\n", file_name);
-        exit(1);
-    }
-
-    png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL,
+                                     read_error, read_warning);
     if (png_ptr == NULL) {
-        fclose(fp);
-        printf("PNG read struct could not be created\r\n");
-        exit(1);
+        return PNGZ_ERROR_DECODE;
     }
 
     info_ptr = png_create_info_struct(png_ptr);
     if (info_ptr == NULL) {
-        fclose(fp);
         png_destroy_read_struct(&png_ptr, NULL, NULL);
-        printf("PNG info struct could not be created\r\n");
-        exit(1);
+        return PNGZ_ERROR_DECODE;
     }
 
     if (setjmp(png_jmpbuf(png_ptr))) {
-        fclose(fp);
         png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
-        printf("Problem reading the file\r\n");
-        exit(1);
+        return PNGZ_ERROR_DECODE;
     }
 
-    // Get original file size
-    fseek(fp, 0L, SEEK_END);
-    original_size = ftell(fp);
-    fseek(fp, 0L, SEEK_SET);
-
-    png_init_io(png_ptr, fp);
+    png_set_read_fn(png_ptr, &reader, read_input);
     png_read_png(png_ptr, info_ptr, png_transforms, NULL);
 
     width = png_get_image_width(png_ptr, info_ptr);
@@ -75,26 +85,26 @@ void load_png(pngz_t *png) {
 
         for(x=0; x<width; x++) {
 
-            uint16_t *src_ptr = (uint16_t*)(row+x*bytes_per_pixel);
+            // Samples are big endian, as in the file.
+            png_byte *src_ptr = row+x*bytes_per_pixel;
             raw_pixel *dest_ptr = &raw_pixels[width*y+x];
 
-            dest_ptr->red = src_ptr[0];
-            dest_ptr->green = src_ptr[1];
-            dest_ptr->blue = src_ptr[2];
+            dest_ptr->red = (src_ptr[0] << 8) | src_ptr[1];
+            dest_ptr->green = (src_ptr[2] << 8) | src_ptr[3];
+            dest_ptr->blue = (src_ptr[4] << 8) | src_ptr[5];
             if(bytes_per_pixel == 6) { // No alpha chanel
                 dest_ptr->alpha = 65535;
             }
             else {
-                dest_ptr->alpha = src_ptr[3];
+                dest_ptr->alpha = (src_ptr[6] << 8) | src_ptr[7];
             }
         }
     }
     png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
-    fclose(fp);
 
     png->width = width;
     png->height = height;
-    png->original_size = original_size;
-    png->best_size = original_size;
+    png->best_size = png->original_size;
     png->raw_pixels = raw_pixels;
-}
\ No newline at end of file
+    return PNGZ_OK;
+}
@@ -3,6 +3,6 @@
 
 #include "pngz.h"
 
-void load_png(pngz_t *png);
+pngz_status load_png(pngz_t *png);
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,124 @@
+#include "memory.h"
+#include "helpers.h"
+#include "zlib_sweep.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+
+// Bytes the footprint estimate counts per byte of filtered stream handed to
+// zopfli, and its fixed cost. The longest match cache holds a length, a
+// distance and 8 three byte sublengths per position; the cost and length
+// arrays and LZ77 stores of the squeeze make up the rest. Blocks never span
+// zopfli's master blocks.
+#define ZOPFLI_CACHE_BYTES 28
+#define ZOPFLI_WORK_BYTES 16
+#define ZOPFLI_FIXED_BYTES ((size_t)1 << 20)
+#define ZOPFLI_MASTER_BLOCK 20000000
+
+// Smallest block worth keeping the match cache for in MEMORY_CAPPED.
+#define MIN_CACHED_BLOCK 65536
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t released = PTHREAD_COND_INITIALIZER;
+static size_t budget = 0; // 0 for none
+static size_t in_use = 0;
+
+void pngz_set_memory_budget(size_t bytes) {
+    pthread_mutex_lock(&lock);
+    budget = bytes;
+    pthread_cond_broadcast(&released);
+    pthread_mutex_unlock(&lock);
+}
+
+// Estimated peak footprint of the search by mode, from the IHDR at the start
+// of every PNG. Pixels are held as 8 byte raw_pixels, plus a second copy while
+// a transparent fill or color key candidate is encoded, and no candidate packs
+// them wider than 8 (16 bit input) or 4 bytes per pixel. The packed candidate
+// and its filtered stream are held while zopfli or zlib_sweep works on the
+// latter.
+typedef struct footprint_s {
+    size_t base;        // Everything but zopfli's cache, in MEMORY_MINIMAL
+    size_t copy;        // The second pixel copy, left out by MEMORY_MINIMAL
+    size_t cache;       // Zopfli's match cache over the largest block
+    size_t block;       // Largest block
+} footprint;
+
+static bool estimate(const pngz_t *png, footprint *fp) {
+    const uint8_t *ihdr = png->input + 16;
+    if(png->original_size < 33 || memcmp(png->input + 12, "IHDR", 4)) {
+        return false;
+    }
+    const size_t width = (uint32_t)ihdr[0] << 24 | ihdr[1] << 16 |
+                         ihdr[2] << 8 | ihdr[3];
+    const size_t height = (uint32_t)ihdr[4] << 24 | ihdr[5] << 16 |
+                          ihdr[6] << 8 | ihdr[7];
+    const size_t pixels = width * height;
+    const size_t stream = pixels * (ihdr[8] == 16 ? 8 : 4) + height;
+
+    fp->block = stream < ZOPFLI_MASTER_BLOCK ? stream : ZOPFLI_MASTER_BLOCK;
+    fp->copy = 8 * pixels;
+    fp->cache = ZOPFLI_CACHE_BYTES * fp->block;
+    fp->base = 8 * pixels + 2 * stream + ZOPFLI_WORK_BYTES * fp->block +
+               ZOPFLI_FIXED_BYTES;
+    if(png->effort->compressor == COMPRESS_ZLIB ||
+       png->effort->estimator == ESTIMATE_DEFLATED) {
+        fp->base += zlib_sweep_footprint(stream, png->options->threads);
+    }
+    return true;
+}
+
+// Settles the image's memory mode and reservation, then waits until the
+// reservation fits. The wait counts against its time budget.
+void memory_admit(pngz_t *png) {
+    footprint fp;
+    png->memory_mode = MEMORY_FULL;
+    png->memory_reserved = 0;
+    png->zopfli_cache_max = 0;
+
+    pthread_mutex_lock(&lock);
+    if(budget == 0 || !estimate(png, &fp)) {
+        pthread_mutex_unlock(&lock);
+        return;
+    }
+
+    const size_t full = fp.base + fp.copy + fp.cache;
+    const size_t uncached = fp.base + fp.copy;
+    if(full <= budget) {
+        png->memory_reserved = full;
+    }
+    else if(uncached + ZOPFLI_CACHE_BYTES * MIN_CACHED_BLOCK <= budget) {
+        // The match cache gets what the budget has left, in smaller blocks.
+        png->memory_mode = MEMORY_CAPPED;
+        png->zopfli_cache_max = (budget - uncached) / ZOPFLI_CACHE_BYTES;
+        png->memory_reserved = budget;
+    }
+    else {
+        png->memory_mode = MEMORY_MINIMAL;
+        png->zopfli_cache_max = 1; // No block is that small
+        png->memory_reserved = fp.base < budget ? fp.base : budget;
+    }
+
+    const double start = monotonic_seconds();
+    while(in_use > 0 && in_use + png->memory_reserved > budget) {
+        pthread_cond_wait(&released, &lock);
+    }
+    in_use += png->memory_reserved;
+    pthread_mutex_unlock(&lock);
+
+    static const char *modes[] = {"full", "capped", "minimal"};
+    trace_event(png->trace, "admit", monotonic_seconds() - start,
+                png->memory_reserved, "\"mode\":\"%s\",\"budget\":%zu",
+                modes[png->memory_mode], budget);
+}
+
+void memory_release(pngz_t *png) {
+    if(png->memory_reserved == 0) {
+        return;
+    }
+    pthread_mutex_lock(&lock);
+    in_use -= png->memory_reserved;
+    pthread_cond_broadcast(&released);
+    pthread_mutex_unlock(&lock);
+    png->memory_reserved = 0;
+}
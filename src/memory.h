@@ -0,0 +1,16 @@
+#ifndef PNGZ_MEMORY_H_
+#define PNGZ_MEMORY_H_
+
+#include "pngz.h"
+
+// Admission control against the process-wide budget set with
+// pngz_set_memory_budget. Before decoding, an image reserves an estimate of
+// its peak footprint and waits while that doesn't fit beside the images
+// already running. An image too big for the budget even alone gets a lower
+// memory mode instead, and if it still doesn't fit, runs once nothing else
+// does.
+
+void memory_admit(pngz_t *png);
+void memory_release(pngz_t *png);
+
+#endif
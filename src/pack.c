@@ -0,0 +1,357 @@
+#include "pngz.h"
+#include "pack.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// Packing turns raw_pixels into the unfiltered scanlines of one color type and
+// bit depth. Every (color type, bit depth) pair gets its own row kernel, stamped
+// out by the macros below, so the inner loops never branch on either. 8 and 16
+// bit kernels write samples straight from raw_pixels; sub-byte depths first
+// write 8 bit samples and then pack them into bits.
+
+size_t packed_bytes_per_row(size_t width, uint8_t color_type,
+                            uint8_t bit_depth) {
+    size_t samples = 1;
+    if(color_type == 2) samples = 3;
+    else if(color_type == 4) samples = 2;
+    else if(color_type == 6) samples = 4;
+    return (width*samples*bit_depth + 7)/8;
+}
+
+// SIMD PREFIXES ////////////////////////////////////////////////
+
+// Each handles as many whole blocks of a row as it can, advances `out` past
+// what it wrote and returns the number of pixels (or samples) done. The scalar
+// loops of the kernels finish the rest.
+
+#define NO_SIMD_ROW(ct, depth)                                                \
+static size_t simd_row_ct##ct##_##depth(const raw_pixel *row, size_t width,   \
+                                        uint8_t **out) {                      \
+    (void)row; (void)width; (void)out;                                        \
+    return 0;                                                                 \
+}
+
+#define NO_SIMD_BITS(depth)                                                   \
+static size_t simd_bits_##depth(const uint8_t *in, size_t n, uint8_t **out) { \
+    (void)in; (void)n; (void)out;                                             \
+    return 0;                                                                 \
+}
+
+#ifdef __SSE2__
+
+// High bytes of 4 pixels as RGBA8.
+static inline __m128i load_rgba8(const raw_pixel *p) {
+    const __m128i a = _mm_loadu_si128((const __m128i*)p);
+    const __m128i b = _mm_loadu_si128((const __m128i*)(p+2));
+    return _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+}
+
+// Narrows 32 bit lanes holding 16 bit values to 16 bit lanes, without the
+// signed saturation of _mm_packs_epi32 getting in the way.
+static inline __m128i narrow_epi32(__m128i a, __m128i b) {
+    a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+    b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+    return _mm_packs_epi32(a, b);
+}
+
+static size_t simd_row_ct0_8(const raw_pixel *row, size_t width,
+                             uint8_t **out) {
+    const __m128i mask = _mm_set1_epi32(0xff);
+    size_t x;
+    for(x=0;x+16<=width;x+=16) {
+        const __m128i a = _mm_and_si128(load_rgba8(row+x), mask);
+        const __m128i b = _mm_and_si128(load_rgba8(row+x+4), mask);
+        const __m128i c = _mm_and_si128(load_rgba8(row+x+8), mask);
+        const __m128i d = _mm_and_si128(load_rgba8(row+x+12), mask);
+        const __m128i grey = _mm_packus_epi16(_mm_packs_epi32(a, b),
+                                              _mm_packs_epi32(c, d));
+        _mm_storeu_si128((__m128i*)*out, grey);
+        *out += 16;
+    }
+    return x;
+}
+
+static size_t simd_row_ct2_8(const raw_pixel *row, size_t width,
+                             uint8_t **out) {
+    uint8_t rgba[16];
+    size_t x;
+    for(x=0;x+4<=width;x+=4) {
+        _mm_storeu_si128((__m128i*)rgba, load_rgba8(row+x));
+        memcpy(*out, rgba, 3);
+        memcpy(*out+3, rgba+4, 3);
+        memcpy(*out+6, rgba+8, 3);
+        memcpy(*out+9, rgba+12, 3);
+        *out += 12;
+    }
+    return x;
+}
+
+static size_t simd_row_ct4_8(const raw_pixel *row, size_t width,
+                             uint8_t **out) {
+    const __m128i grey_mask = _mm_set1_epi32(0xff);
+    const __m128i alpha_mask = _mm_set1_epi32(0xff00);
+    size_t x;
+    for(x=0;x+8<=width;x+=8) {
+        const __m128i a = load_rgba8(row+x);
+        const __m128i b = load_rgba8(row+x+4);
+        const __m128i ga = _mm_or_si128(
+            _mm_and_si128(a, grey_mask),
+            _mm_and_si128(_mm_srli_epi32(a, 16), alpha_mask));
+        const __m128i gb = _mm_or_si128(
+            _mm_and_si128(b, grey_mask),
+            _mm_and_si128(_mm_srli_epi32(b, 16), alpha_mask));
+        _mm_storeu_si128((__m128i*)*out, narrow_epi32(ga, gb));
+        *out += 16;
+    }
+    return x;
+}
+
+static size_t simd_row_ct6_8(const raw_pixel *row, size_t width,
+                             uint8_t **out) {
+    size_t x;
+    for(x=0;x+4<=width;x+=4) {
+        _mm_storeu_si128((__m128i*)*out, load_rgba8(row+x));
+        *out += 16;
+    }
+    return x;
+}
+
+// raw_pixels already are RGBA16, just in host byte order.
+static size_t simd_row_ct6_16(const raw_pixel *row, size_t width,
+                              uint8_t **out) {
+    size_t x;
+    for(x=0;x+2<=width;x+=2) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(row+x));
+        const __m128i swapped = _mm_or_si128(_mm_slli_epi16(v, 8),
+                                             _mm_srli_epi16(v, 8));
+        _mm_storeu_si128((__m128i*)*out, swapped);
+        *out += 16;
+    }
+    return x;
+}
+
+// Joins the two samples of every 16 bit lane into one byte, the first one in
+// the high bits: (s0 << shift) | s1.
+static inline __m128i join_pairs(__m128i v, int shift) {
+    const __m128i low = _mm_and_si128(v, _mm_set1_epi16(0x00ff));
+    return _mm_or_si128(_mm_slli_epi16(low, shift), _mm_srli_epi16(v, 8));
+}
+
+static uint8_t reverse_bits(uint8_t b) {
+    return ((b * 0x0802LU & 0x22110LU) | (b * 0x8020LU & 0x88440LU))
+           * 0x10101LU >> 16;
+}
+
+static size_t simd_bits_1(const uint8_t *in, size_t n, uint8_t **out) {
+    size_t x;
+    for(x=0;x+16<=n;x+=16) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(in+x));
+        // Moves each sample bit into the sign bit of its byte.
+        const int bits = _mm_movemask_epi8(_mm_slli_epi16(v, 7));
+        (*out)[0] = reverse_bits(bits & 0xff);
+        (*out)[1] = reverse_bits(bits >> 8);
+        *out += 2;
+    }
+    return x;
+}
+
+static size_t simd_bits_2(const uint8_t *in, size_t n, uint8_t **out) {
+    size_t x;
+    for(x=0;x+64<=n;x+=64) {
+        const __m128i a = _mm_loadu_si128((const __m128i*)(in+x));
+        const __m128i b = _mm_loadu_si128((const __m128i*)(in+x+16));
+        const __m128i c = _mm_loadu_si128((const __m128i*)(in+x+32));
+        const __m128i d = _mm_loadu_si128((const __m128i*)(in+x+48));
+        const __m128i ab = _mm_packus_epi16(join_pairs(a, 2),
+                                            join_pairs(b, 2));
+        const __m128i cd = _mm_packus_epi16(join_pairs(c, 2),
+                                            join_pairs(d, 2));
+        _mm_storeu_si128((__m128i*)*out,
+                         _mm_packus_epi16(join_pairs(ab, 4),
+                                          join_pairs(cd, 4)));
+        *out += 16;
+    }
+    return x;
+}
+
+static size_t simd_bits_4(const uint8_t *in, size_t n, uint8_t **out) {
+    size_t x;
+    for(x=0;x+32<=n;x+=32) {
+        const __m128i a = _mm_loadu_si128((const __m128i*)(in+x));
+        const __m128i b = _mm_loadu_si128((const __m128i*)(in+x+16));
+        _mm_storeu_si128((__m128i*)*out,
+                         _mm_packus_epi16(join_pairs(a, 4),
+                                          join_pairs(b, 4)));
+        *out += 16;
+    }
+    return x;
+}
+
+static size_t simd_shift_samples(uint8_t *samples, size_t n,
+                                 unsigned int shift) {
+    const __m128i mask = _mm_set1_epi8((char)(0xff >> shift));
+    size_t x;
+    for(x=0;x+16<=n;x+=16) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(samples+x));
+        _mm_storeu_si128((__m128i*)(samples+x),
+                         _mm_and_si128(_mm_srli_epi16(v, shift), mask));
+    }
+    return x;
+}
+
+#else
+
+NO_SIMD_ROW(0, 8)
+NO_SIMD_ROW(2, 8)
+NO_SIMD_ROW(4, 8)
+NO_SIMD_ROW(6, 8)
+NO_SIMD_ROW(6, 16)
+NO_SIMD_BITS(1)
+NO_SIMD_BITS(2)
+NO_SIMD_BITS(4)
+
+static size_t simd_shift_samples(uint8_t *samples, size_t n,
+                                 unsigned int shift) {
+    (void)samples; (void)n; (void)shift;
+    return 0;
+}
+
+#endif
+
+NO_SIMD_ROW(0, 16)
+NO_SIMD_ROW(2, 16)
+NO_SIMD_ROW(4, 16)
+
+// ROW KERNELS ////////////////////////////////////////////////
+
+#define PUT_8(out, v) *(out)++ = (uint8_t)((v) >> 8);
+#define PUT_16(out, v) *(out)++ = (uint8_t)((v) >> 8); *(out)++ = (uint8_t)(v);
+
+#define CHANNELS_0(put, out, p) put(out, p.red)
+#define CHANNELS_2(put, out, p) put(out, p.red) put(out, p.green) \
+                                put(out, p.blue)
+#define CHANNELS_4(put, out, p) put(out, p.red) put(out, p.alpha)
+#define CHANNELS_6(put, out, p) put(out, p.red) put(out, p.green) \
+                                put(out, p.blue) put(out, p.alpha)
+
+#define DEFINE_ROW_KERNEL(ct, depth)                                          \
+static void pack_row_ct##ct##_##depth(const raw_pixel *row, size_t width,     \
+                                      uint8_t *out) {                         \
+    size_t x = simd_row_ct##ct##_##depth(row, width, &out);                   \
+    for(;x<width;x++) {                                                       \
+        const raw_pixel p = row[x];                                           \
+        CHANNELS_##ct(PUT_##depth, out, p)                                    \
+    }                                                                         \
+}
+
+DEFINE_ROW_KERNEL(0, 8)
+DEFINE_ROW_KERNEL(0, 16)
+DEFINE_ROW_KERNEL(2, 8)
+DEFINE_ROW_KERNEL(2, 16)
+DEFINE_ROW_KERNEL(4, 8)
+DEFINE_ROW_KERNEL(4, 16)
+DEFINE_ROW_KERNEL(6, 8)
+DEFINE_ROW_KERNEL(6, 16)
+
+// BIT PACKING KERNELS ////////////////////////////////////////////////
+
+// Packs `n` samples below 2^depth, one per byte, most significant bits first.
+// A partial last byte is padded with zero bits.
+#define DEFINE_BITS_KERNEL(depth)                                             \
+static void pack_bits_##depth(const uint8_t *in, size_t n, uint8_t *out) {    \
+    const unsigned int per_byte = 8 / depth;                                  \
+    size_t x = simd_bits_##depth(in, n, &out);                                \
+    unsigned int k;                                                           \
+    for(;x+per_byte<=n;x+=per_byte) {                                         \
+        uint8_t b = 0;                                                        \
+        for(k=0;k<per_byte;k++) b = (b << depth) | in[x+k];                   \
+        *out++ = b;                                                           \
+    }                                                                         \
+    if(x < n) {                                                               \
+        uint8_t b = 0;                                                        \
+        for(k=0;k<per_byte;k++) {                                             \
+            b = (b << depth) | (x+k < n ? in[x+k] : 0);                       \
+        }                                                                     \
+        *out = b;                                                             \
+    }                                                                         \
+}
+
+DEFINE_BITS_KERNEL(1)
+DEFINE_BITS_KERNEL(2)
+DEFINE_BITS_KERNEL(4)
+
+static void pack_bits(const uint8_t *in, size_t n, uint8_t bit_depth,
+                      uint8_t *out) {
+    switch(bit_depth) {
+        case 1: pack_bits_1(in, n, out); break;
+        case 2: pack_bits_2(in, n, out); break;
+        case 4: pack_bits_4(in, n, out); break;
+        default: memcpy(out, in, n); break;
+    }
+}
+
+// Scales 8 bit samples down to the sub-byte depth they were found to fit.
+static void shift_samples(uint8_t *samples, size_t n, unsigned int shift) {
+    size_t x = simd_shift_samples(samples, n, shift);
+    for(;x<n;x++) {
+        samples[x] >>= shift;
+    }
+}
+
+typedef void (*row_kernel)(const raw_pixel*, size_t, uint8_t*);
+
+static row_kernel select_row_kernel(uint8_t color_type, uint8_t bit_depth) {
+    const int wide = bit_depth == 16;
+    switch(color_type) {
+        case 0: return wide ? pack_row_ct0_16 : pack_row_ct0_8;
+        case 2: return wide ? pack_row_ct2_16 : pack_row_ct2_8;
+        case 4: return wide ? pack_row_ct4_16 : pack_row_ct4_8;
+        case 6: return wide ? pack_row_ct6_16 : pack_row_ct6_8;
+        default: exit(1);
+    }
+}
+
+// Writes the unfiltered scanlines of color type 0, 2, 4 or 6 at `bit_depth`.
+// Samples are scaled down by dropping low bits, which is exact for the depths
+// the analysis found the image to fit in.
+void pack_pixels(const pngz_t *png, uint8_t color_type, uint8_t bit_depth,
+                 uint8_t *out) {
+    const size_t width = png->width;
+    const size_t bytes_per_row = packed_bytes_per_row(width, color_type,
+                                                      bit_depth);
+    size_t y;
+
+    if(bit_depth >= 8) {
+        const row_kernel kernel = select_row_kernel(color_type, bit_depth);
+        for(y=0;y<png->height;y++) {
+            kernel(&png->raw_pixels[y*width], width, out + y*bytes_per_row);
+        }
+        return;
+    }
+
+    // Only greyscale goes below 8 bits.
+    uint8_t *samples = malloc(width);
+    for(y=0;y<png->height;y++) {
+        pack_row_ct0_8(&png->raw_pixels[y*width], width, samples);
+        shift_samples(samples, width, 8 - bit_depth);
+        pack_bits(samples, width, bit_depth, out + y*bytes_per_row);
+    }
+    free(samples);
+}
+
+// Writes the unfiltered scanlines of color type 3 from one palette index per
+// pixel.
+void pack_indices(const uint8_t *indices, size_t width, size_t height,
+                  uint8_t bit_depth, uint8_t *out) {
+    const size_t bytes_per_row = packed_bytes_per_row(width, 3, bit_depth);
+    size_t y;
+    for(y=0;y<height;y++) {
+        pack_bits(indices + y*width, width, bit_depth, out + y*bytes_per_row);
+    }
+}
@@ -0,0 +1,15 @@
+#ifndef PNGZ_PACK_H_
+#define PNGZ_PACK_H_
+
+#include "pngz.h"
+#include <stdint.h>
+
+size_t packed_bytes_per_row(size_t width, uint8_t color_type,
+                            uint8_t bit_depth);
+
+void pack_pixels(const pngz_t *png, uint8_t color_type, uint8_t bit_depth,
+                 uint8_t *out);
+void pack_indices(const uint8_t *indices, size_t width, size_t height,
+                  uint8_t bit_depth, uint8_t *out);
+
+#endif
@@ -0,0 +1,278 @@
+#include "pngz.h"
+#include "palette.h"
+#include "color_set.h"
+#include "filter.h"
+#include "pack.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Palette order changes nothing about which colors are used, but it decides
+// what the filters see and how long tRNS is. Several orderings are built and
+// the one the filter estimator likes best is used.
+
+enum {
+    ORDER_IMAGE,       // First appearance in the image
+    ORDER_POPULARITY,  // Most used first
+    ORDER_LUMINANCE,   // Dark to light
+    ORDER_TRNS_FIRST,  // Non-opaque entries first, shortening tRNS
+    ORDER_ADJACENCY,   // Greedy walk along the most frequent neighbor pairs
+    NUM_ORDERS
+};
+
+// Maps every pixel to its index in the color set. The set is a hash table and
+// runs of one color skip even that, so this is linear in the pixel count.
+uint8_t* palette_color_indices(const pngz_t *png, const color_set *cset) {
+    const size_t total_px = png->width * png->height;
+    uint8_t *indices = malloc(total_px);
+    raw_pixel last;
+    int last_index = -1;
+    size_t i;
+    for(i=0;i<total_px;i++) {
+        const raw_pixel current = normalize_transparent(png->raw_pixels[i]);
+        if(last_index < 0 || memcmp(&current, &last, sizeof(raw_pixel))) {
+            last = current;
+            last_index = color_set_index(cset, current);
+        }
+        indices[i] = last_index;
+    }
+    return indices;
+}
+
+void palette_apply(const palette *pal, uint8_t *indices, size_t n) {
+    size_t i;
+    for(i=0;i<n;i++) {
+        indices[i] = pal->remap[indices[i]];
+    }
+}
+
+// Fills in the PLTE and tRNS chunks. tRNS only extends to the last entry that
+// isn't opaque.
+void palette_chunks(pngz_t *png, const color_set *cset, const palette *pal) {
+    size_t i;
+    png->plte = malloc(3*pal->size);
+    png->plte_size = 3*pal->size;
+    png->trns = malloc(pal->size);
+    png->trns_size = 0;
+    for(i=0;i<pal->size;i++) {
+        const raw_pixel color = cset->colors[pal->order[i]];
+        png->plte[i*3+0] = color.red >> 8;
+        png->plte[i*3+1] = color.green >> 8;
+        png->plte[i*3+2] = color.blue >> 8;
+        png->trns[i] = color.alpha >> 8;
+        if(png->trns[i] != 255) {
+            png->trns_size = i+1;
+        }
+    }
+}
+
+// ORDERINGS ////////////////////////////////////////////////
+
+typedef struct sort_entry_s {
+    uint64_t key;
+    uint8_t index;
+} sort_entry;
+
+// Ascending key, color set index breaking ties.
+static int sort_entry_cmp(const void *a, const void *b) {
+    const sort_entry *x = a;
+    const sort_entry *y = b;
+    if(x->key != y->key) return x->key < y->key ? -1 : 1;
+    return x->index - y->index;
+}
+
+static void order_by_key(const color_set *cset, uint64_t (*key)(const color_set*,
+                         size_t), uint8_t *order) {
+    sort_entry entries[COLOR_SET_MAX];
+    size_t i;
+    for(i=0;i<cset->size;i++) {
+        entries[i].key = key(cset, i);
+        entries[i].index = i;
+    }
+    qsort(entries, cset->size, sizeof(sort_entry), sort_entry_cmp);
+    for(i=0;i<cset->size;i++) {
+        order[i] = entries[i].index;
+    }
+}
+
+static uint64_t popularity_key(const color_set *cset, size_t i) {
+    return ~(uint64_t)cset->counts[i];
+}
+
+static uint64_t luminance_key(const color_set *cset, size_t i) {
+    const raw_pixel c = cset->colors[i];
+    const uint64_t luma = 299*(c.red >> 8) + 587*(c.green >> 8) +
+                          114*(c.blue >> 8);
+    return (luma << 16) | c.alpha;
+}
+
+// Non-opaque colors by ascending alpha, then opaque ones by popularity.
+static uint64_t trns_first_key(const color_set *cset, size_t i) {
+    const raw_pixel c = cset->colors[i];
+    if(c.alpha != 65535) {
+        return c.alpha;
+    }
+    return ((uint64_t)1 << 32) | (uint32_t)~cset->counts[i];
+}
+
+// Counts how often each pair of colors is horizontally or vertically adjacent.
+static uint32_t* cooccurrence(const pngz_t *png, const uint8_t *indices) {
+    uint32_t *matrix = calloc(COLOR_SET_MAX*COLOR_SET_MAX, sizeof(uint32_t));
+    size_t x, y;
+    for(y=0;y<png->height;y++) {
+        const uint8_t *row = indices + y*png->width;
+        for(x=0;x<png->width;x++) {
+            if(x > 0 && row[x] != row[x-1]) {
+                matrix[row[x]*COLOR_SET_MAX + row[x-1]]++;
+                matrix[row[x-1]*COLOR_SET_MAX + row[x]]++;
+            }
+            if(y > 0 && row[x] != row[x-png->width]) {
+                matrix[row[x]*COLOR_SET_MAX + row[x-png->width]]++;
+                matrix[row[x-png->width]*COLOR_SET_MAX + row[x]]++;
+            }
+        }
+    }
+    return matrix;
+}
+
+// Starts at the most popular color and keeps appending the unused color that
+// neighbors the previous one most often, so colors that touch in the image get
+// nearby indices.
+static void order_by_adjacency(const pngz_t *png, const color_set *cset,
+                               const uint8_t *indices, uint8_t *order) {
+    uint32_t *matrix = cooccurrence(png, indices);
+    bool used[COLOR_SET_MAX] = {false};
+    size_t i, k;
+
+    size_t current = 0;
+    for(i=1;i<cset->size;i++) {
+        if(cset->counts[i] > cset->counts[current]) current = i;
+    }
+    order[0] = current;
+    used[current] = true;
+
+    for(k=1;k<cset->size;k++) {
+        const uint32_t *row = matrix + current*COLOR_SET_MAX;
+        int best = -1;
+        for(i=0;i<cset->size;i++) {
+            if(used[i]) continue;
+            if(best < 0 || row[i] > row[best] ||
+               (row[i] == row[best] && cset->counts[i] > cset->counts[best])) {
+                best = i;
+            }
+        }
+        current = best;
+        order[k] = current;
+        used[current] = true;
+    }
+    free(matrix);
+}
+
+static void build_order(int which, const pngz_t *png, const color_set *cset,
+                        const uint8_t *indices, uint8_t *order) {
+    size_t i;
+    switch(which) {
+        case ORDER_POPULARITY:
+            order_by_key(cset, popularity_key, order);
+            break;
+        case ORDER_LUMINANCE:
+            order_by_key(cset, luminance_key, order);
+            break;
+        case ORDER_TRNS_FIRST:
+            order_by_key(cset, trns_first_key, order);
+            break;
+        case ORDER_ADJACENCY:
+            order_by_adjacency(png, cset, indices, order);
+            break;
+        default:
+            for(i=0;i<cset->size;i++) order[i] = i;
+            break;
+    }
+}
+
+// EVALUATION ////////////////////////////////////////////////
+
+typedef struct order_job_s {
+    int which;
+    const pngz_t *png;
+    const color_set *cset;
+    const uint8_t *indices;
+    uint8_t bit_depth;
+    palette pal;
+    double estimate;
+} order_job;
+
+// Builds one ordering and estimates the image with it, a row at a time.
+static void* evaluate_order(void *arg) {
+    order_job *job = arg;
+    const pngz_t *png = job->png;
+    const size_t width = png->width;
+    const size_t row_size = packed_bytes_per_row(width, 3, job->bit_depth);
+    size_t i, y;
+
+    job->pal.size = job->cset->size;
+    build_order(job->which, png, job->cset, job->indices, job->pal.order);
+    for(i=0;i<job->pal.size;i++) {
+        job->pal.remap[job->pal.order[i]] = i;
+    }
+
+    uint8_t *remapped = malloc(width);
+    uint8_t *packed = malloc(row_size);
+    filter_estimator *est = filter_estimator_create(row_size, 1);
+    for(y=0;y<png->height;y++) {
+        memcpy(remapped, job->indices + y*width, width);
+        palette_apply(&job->pal, remapped, width);
+        pack_indices(remapped, width, 1, job->bit_depth, packed);
+        filter_estimator_add_row(est, packed);
+    }
+
+    size_t trns_size = 0;
+    for(i=0;i<job->pal.size;i++) {
+        if(job->cset->colors[job->pal.order[i]].alpha != 65535) {
+            trns_size = i+1;
+        }
+    }
+    job->estimate = filter_estimator_size(est) + trns_size;
+
+    filter_estimator_delete(est);
+    free(packed);
+    free(remapped);
+    return NULL;
+}
+
+// Picks the palette order with the smallest estimated size. The orderings are
+// independent, so each is built and estimated on its own thread.
+void palette_choose(const pngz_t *png, const color_set *cset,
+                    const uint8_t *color_indices, uint8_t bit_depth,
+                    palette *pal) {
+    order_job jobs[NUM_ORDERS];
+    pthread_t threads[NUM_ORDERS];
+    bool started[NUM_ORDERS];
+    int i;
+
+    for(i=0;i<NUM_ORDERS;i++) {
+        jobs[i].which = i;
+        jobs[i].png = png;
+        jobs[i].cset = cset;
+        jobs[i].indices = color_indices;
+        jobs[i].bit_depth = bit_depth;
+        started[i] = pthread_create(&threads[i], NULL, evaluate_order,
+                                    &jobs[i]) == 0;
+        if(!started[i]) {
+            evaluate_order(&jobs[i]);
+        }
+    }
+
+    int best = 0;
+    for(i=0;i<NUM_ORDERS;i++) {
+        if(started[i]) {
+            pthread_join(threads[i], NULL);
+        }
+        if(jobs[i].estimate < jobs[best].estimate) {
+            best = i;
+        }
+    }
+    *pal = jobs[best].pal;
+}
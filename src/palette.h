@@ -0,0 +1,21 @@
+#ifndef PNGZ_PALETTE_H_
+#define PNGZ_PALETTE_H_
+
+#include "pngz.h"
+#include "color_set.h"
+#include <stdint.h>
+
+typedef struct palette_s {
+    size_t size;
+    uint8_t order[COLOR_SET_MAX]; // Color set index of each palette entry
+    uint8_t remap[COLOR_SET_MAX]; // Palette entry of each color set index
+} palette;
+
+uint8_t* palette_color_indices(const pngz_t *png, const color_set *cset);
+void palette_choose(const pngz_t *png, const color_set *cset,
+                    const uint8_t *color_indices, uint8_t bit_depth,
+                    palette *pal);
+void palette_apply(const palette *pal, uint8_t *indices, size_t n);
+void palette_chunks(pngz_t *png, const color_set *cset, const palette *pal);
+
+#endif
@@ -1,129 +1,253 @@
-#include "pngz.h"
-#include "load.h"
-#include "colortypes.h"
-#include "filter.h"
-#include "compress.h"
-#include "save.h"
-#include "helpers.h"
+#include "libpngz.h"
 
-#include <unistd.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
-#include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
 
 #define PNGZ_VERSION "0.0.1"
 
 static const char *msg_help =
         "pngz "PNGZ_VERSION" - the (nearly) optimal lossless PNG optimizer\r\n"
-        "Usage: pngz <input_file> <output_file>\r\n"
+        "Usage: pngz [options] <input_file> <output_file>\r\n"
+        "       Either file may be - for stdin/stdout.\r\n"
         "       -h, --help        show this info\r\n"
-        "       -v, --version     print version\r\n";
-
-static void colortype_callback(pngz_t*, void*);
-static void filter_callback(pngz_t*, void*, size_t);
-static void compress_callback(pngz_t*);
-static void print_results(const pngz_t*);
-static size_t compute_output_size(const pngz_t*);
-
-static void parse_opts(pngz_options *options, int argc, char *argv[]) {
+        "       -v, --version     print version\r\n"
+        "       -o<0-6>           effort, from quickest to most exhaustive\r\n"
+        "                         (default 4)\r\n"
+        "       --cache <dir>     reuse and record results in <dir>\r\n"
+        "       --force           search even if the input looks optimized\r\n"
+        "       --memory <MB>     search in less memory if needed to stay\r\n"
+        "                         under <MB>\r\n"
+        "       --threads <n>     threads for the zlib tier (-o0, -o1)\r\n"
+        "                         (default: cores)\r\n"
+        "       --time-budget <s> stop searching after <s> seconds\r\n"
+        "       --trace <file>    append per-stage timings to <file> as JSONL\r\n";
+
+typedef struct cli_options_s
+{
+    char *input_filename;
+    char *output_filename;
+    pngz_params params;
+    FILE *report; // Progress and results, out of the way of a PNG on stdout
+
+} cli_options;
+
+static void print_results(FILE*, const pngz_stats*);
+
+static void parse_opts(cli_options *options, int argc, char *argv[]) {
+
+    int i;
+    int positional = 0;
+
+    pngz_params_init(&options->params);
+    options->params.verbose = true;
+    // The only image in the process may have every core.
+    const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    options->params.threads = cores > 0 ? (int)cores : 1;
 
     if(argc == 1) {
         printf("%s\n", msg_help);
         exit(0);
     }
-    if(argc == 2) {
-        if(!strcmp(argv[1], "-h") || !strcmp(argv[1], "--help")) {
+    for(i=1;i<argc;i++) {
+        if(!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")) {
             printf("%s\n", msg_help);
             exit(0);
         }
-        if(!strcmp(argv[1], "-v") || !strcmp(argv[1], "--version")){
+        else if(!strcmp(argv[i], "-v") || !strcmp(argv[i], "--version")){
             printf("%s\n", PNGZ_VERSION);
             exit(0);
         }
+        else if(argv[i][0] == '-' && argv[i][1] == 'o' && argv[i][2] >= '0' &&
+                argv[i][2] <= '9' && argv[i][3] == '\0') {
+            options->params.effort = argv[i][2] - '0';
+            if(options->params.effort > PNGZ_MAX_EFFORT) {
+                printf("No effort level %s\r\n%s\r\n", argv[i], msg_help);
+                exit(1);
+            }
+        }
+        else if(!strcmp(argv[i], "--force")) {
+            options->params.force = true;
+        }
+        else if(!strcmp(argv[i], "--threads") && i+1 < argc) {
+            options->params.threads = atoi(argv[++i]);
+        }
+        else if(!strcmp(argv[i], "--time-budget") && i+1 < argc) {
+            options->params.time_budget = strtod(argv[++i], NULL);
+        }
+        else if(!strcmp(argv[i], "--trace") && i+1 < argc) {
+            options->params.trace_filename = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--memory") && i+1 < argc) {
+            pngz_set_memory_budget(strtoull(argv[++i], NULL, 10) << 20);
+        }
+        else if(!strcmp(argv[i], "--cache") && i+1 < argc) {
+            options->params.cache_dir = argv[++i];
+        }
+        else if(positional == 0) {
+            options->input_filename = argv[i];
+            positional++;
+        }
+        else if(positional == 1) {
+            options->output_filename = argv[i];
+            positional++;
+        }
+        else {
+            positional++;
+        }
+    }
+    if(positional != 2) {
         printf("Invalid number of arguments\r\n%s\r\n", msg_help);
         exit(0);
     }
-    options->input_filename = argv[1];
-    options->output_filename = argv[2];
+    options->params.name = options->input_filename;
+    if(!strcmp(options->input_filename, "-")) {
+        options->params.name = "(stdin)";
+    }
+    options->report = stdout;
+    if(!strcmp(options->output_filename, "-")) {
+        options->report = stderr;
+        options->params.verbose = false;
+    }
+    // The cache never creates its directory and fails silently without it.
+    struct stat st;
+    if(options->params.cache_dir &&
+       (stat(options->params.cache_dir, &st) != 0 || !S_ISDIR(st.st_mode))) {
+        fprintf(options->report, "Cache directory '%s' does not exist, "
+                "nothing will be cached\r\n", options->params.cache_dir);
+    }
 }
 
-int main(int argc, char *argv[]) {
+// stdin can't be measured up front, so it's read until EOF.
+static void* read_stdin(size_t *size) {
+    size_t capacity = 1 << 16;
+    uint8_t *data = malloc(capacity);
+    *size = 0;
+    for(;;) {
+        *size += fread(data + *size, 1, capacity - *size, stdin);
+        if(*size < capacity) {
+            break;
+        }
+        capacity *= 2;
+        data = realloc(data, capacity);
+    }
+    if(ferror(stdin)) {
+        fprintf(stderr, "stdin could not be read\r\n");
+        exit(1);
+    }
+    return data;
+}
 
-    pngz_options options;
-    parse_opts(&options, argc, argv);
+static void* read_file(const char *filename, size_t *size) {
+    if(!strcmp(filename, "-")) {
+        return read_stdin(size);
+    }
+    FILE *fp = fopen(filename, "rb");
+    if(!fp) {
+        printf("File '%s' could not be opened\r\n", filename);
+        exit(1);
+    }
+    fseek(fp, 0L, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0L, SEEK_SET);
+
+    void *data = malloc(*size ? *size : 1);
+    if(fread(data, 1, *size, fp) != *size) {
+        printf("File '%s' could not be read\r\n", filename);
+        exit(1);
+    }
+    fclose(fp);
+    return data;
+}
 
-    printf("pngz %s\r\n", PNGZ_VERSION);
+static void write_file(const char *filename, const void *data, size_t size) {
+    if(!strcmp(filename, "-")) {
+        if(fwrite(data, 1, size, stdout) != size || fflush(stdout) != 0) {
+            fprintf(stderr, "stdout could not be written\r\n");
+            exit(1);
+        }
+        return;
+    }
+    FILE *fp = fopen(filename, "wb");
+    if(!fp) {
+        printf("Output file '%s' could not be opened.\n", filename);
+        exit(1);
+    }
+    if(fwrite(data, 1, size, fp) != size || fclose(fp) != 0) {
+        printf("Output file '%s' could not be written.\n", filename);
+        exit(1);
+    }
+}
 
-    pngz_t png;
-    png.options = &options;
+int main(int argc, char *argv[]) {
 
-    png.plte_size = 0;
-    png.trns_size = 0;
+    cli_options options;
+    parse_opts(&options, argc, argv);
 
-    load_png(&png);
-    colortype_dispatch(&png, &colortype_callback);
+    FILE *report = options.report;
+    fprintf(report, "pngz %s\r\n", PNGZ_VERSION);
+
+    size_t in_size, out_size;
+    void *in = read_file(options.input_filename, &in_size);
+    void *out;
+    pngz_stats stats;
+    options.params.stats = &stats;
+
+    pngz_status status = pngz_optimize(in, in_size, &out, &out_size,
+                                       &options.params);
+    if(status != PNGZ_OK) {
+        fprintf(report, "'%s': %s\r\n", options.params.name,
+                pngz_strerror(status));
+        exit(1);
+    }
+    write_file(options.output_filename, out, out_size);
 
-    print_results(&png);
+    if(stats.cache_hit) {
+        fprintf(report, "cache hit\r\n");
+    }
+    if(stats.passed_through) {
+        fprintf(report, "input already optimized, passing through\r\n");
+    }
+    print_results(report, &stats);
 
     // Cleanup
-    free(png.raw_pixels);
+    free(in);
+    pngz_free(out);
 
     return 0;
 }
 
-// callback passed to colortype methods
-static void colortype_callback(pngz_t *png, void *unfiltered) {
-    filter(png, unfiltered, &filter_callback);
-}
-
-// callback passed to filter method
-static void filter_callback(pngz_t *png, void *filtered, size_t filtered_size) {
-    compress(png, filtered, filtered_size, &compress_callback);
-}
-
-// callback passed to compress method
-static void compress_callback(pngz_t *png) {
-    size_t output_size = compute_output_size(png);
-    //printf("outsize %dB\n", output_size);
-    if(output_size < png->best_size) {
-        save_png(png);
-        png->best_size = output_size;
-    }
-}
+static void print_results(FILE *report, const pngz_stats *stats) {
 
-static size_t compute_output_size(const pngz_t *png) {
-    size_t output_size = 0;
-    output_size += (8 + 25 + 12); // Signature + IHDR + IEND
+    const size_t original = stats->original_size;
+    const size_t best = stats->optimized_size;
 
-    // Chunks have 12 bytes overhead (4 length, 4 type, 4 crc)
-    output_size += png->idat_size + 12;
-    if(png->plte_size > 0) {
-        output_size += png->plte_size + 12;
+    fprintf(report, "pngz completed in %.2f seconds (%.2f CPU)\r\n",
+            stats->seconds, (double)clock() / CLOCKS_PER_SEC);
+    fprintf(report, "original size:      %30zuB\r\n", original);
+    fprintf(report, "optimized size:     %30zuB\r\n", best);
+    fprintf(report, "candidates:         %30zu\r\n", stats->candidates);
+    fprintf(report, "duplicates skipped: %30zu\r\n",
+            stats->duplicates_skipped);
+    if(stats->deadline_reached) {
+        fprintf(report, "time budget reached, search cut short\r\n");
     }
-    if(png->trns_size > 0) {
-        output_size += png->trns_size + 12;
+    if(stats->memory_reduced) {
+        fprintf(report, "searched in less memory to fit the budget\r\n");
     }
-    return output_size;
-}
-
-static void print_results(const pngz_t *png) {
-
-    const size_t original = png->original_size;
-    const size_t best = png->best_size;
-
-    printf("pngz completed in %ld seconds\r\n", clock()/CLOCKS_PER_SEC);
-    printf("original size:      %30dB\r\n", original);
-    printf("optimized size:     %30dB\r\n", best);
 
     if(original == best) {
-        printf("no improvement :(\r\n");
+        fprintf(report, "no improvement :(\r\n");
     }
     else {
         float improvement = 100 - (float)best/original*100;
-        printf("byte decrease:      %30dB\r\n", best-original);
-        printf("percent decrease:   %30.2f%%\r\n", improvement);
+        fprintf(report, "byte decrease:      %30ldB\r\n",
+                (long)(best-original));
+        fprintf(report, "percent decrease:   %30.2f%%\r\n", improvement);
     }
-}
\ No newline at end of file
+}
@@ -3,13 +3,10 @@
 
 #include <stdlib.h>
 #include <stdint.h>
-
-typedef struct pngz_options_s
-{
-    char *input_filename;
-    char *output_filename;
-
-} pngz_options;
+#include <stdbool.h>
+#include "trace.h"
+#include "effort.h"
+#include "libpngz.h"
 
 typedef struct raw_pixel_s
 {
@@ -20,6 +17,14 @@ typedef struct raw_pixel_s
 
 } raw_pixel;
 
+// What an image gives up to fit the memory budget (see memory.h).
+typedef enum memory_mode_e {
+    MEMORY_FULL,
+    MEMORY_CAPPED,  // Zopfli's match cache only for blocks that fit
+    MEMORY_MINIMAL  // No match cache, and no candidates that need a second
+                    // copy of the pixels (transparent fills, color keys)
+} memory_mode;
+
 typedef struct pngz_s
 {
     size_t width;
@@ -28,11 +33,22 @@ typedef struct pngz_s
     size_t original_size;
     size_t best_size;
 
-    pngz_options *options;
+    const pngz_params *options;
+    const effort_preset *effort;
     raw_pixel *raw_pixels;
 
+    // The input file, and the smallest output so far (NULL while nothing
+    // has beaten the input).
+    const uint8_t *input;
+    uint8_t *best_png;
+
     uint8_t bit_depth;
     uint8_t color_type;
+    uint8_t transparent_fill; // See colortypes.c
+    bool color_key;
+
+    // Whether the result cache knows the input as pngz's own output.
+    bool passed_through;
 
     uint8_t *idat;
     size_t idat_size;
@@ -43,6 +59,60 @@ typedef struct pngz_s
     uint8_t *plte;
     size_t plte_size;
 
+    // Reusable buffer filter candidates are materialized into for the
+    // compressor, with the unfiltered data and row filters it holds.
+    uint8_t *filtered;
+    size_t filtered_capacity;
+    const uint8_t *filtered_source;
+    uint8_t *filtered_row_filters;
+    const char *filter_strategy;
+
+    // Deflated size of the last encoding ESTIMATE_DEFLATED measured.
+    size_t deflated_estimate;
+
+    // Hashes of the candidates compressed so far, to skip repeats.
+    uint64_t (*candidate_hashes)[2];
+    size_t candidate_hashes_size;
+    size_t candidate_hashes_capacity;
+    size_t candidates_compressed;
+    size_t candidates_skipped;
+
+    // Per-stage timings go here, if asked for.
+    trace *trace;
+    double start_time; // Monotonic
+
+    // Monotonic time by which the search has to finish, 0 for none, whether
+    // candidates were left untried because of it, and whether zopfli ran
+    // fewer iterations on some candidate to make it.
+    double deadline;
+    bool deadline_reached;
+    bool iterations_cut;
+    // Seconds the first zopfli candidate needed to give a result at all:
+    // block splitting, the greedy pass, one iteration and encoding. No later
+    // candidate starts with less time left. 0 until measured.
+    double candidate_floor;
+
+    // Bytes held against the memory budget, and what was given up to fit.
+    size_t memory_reserved;
+    memory_mode memory_mode;
+    size_t zopfli_cache_max; // cachemaxblocksize for zopfli, 0 for no cap
+
+    // Parameters of the candidate that produced best_size, if any did.
+    uint8_t best_color_type;
+    uint8_t best_bit_depth;
+    uint8_t best_transparent_fill;
+    bool best_color_key;
+    const char *best_filter_strategy;
+    uint8_t *best_row_filters;
+
+    // The encoding and row filters of a cached result for these pixels under
+    // other options, which the search tries first (row filters NULL if none).
+    uint8_t warm_color_type;
+    uint8_t warm_bit_depth;
+    uint8_t warm_transparent_fill;
+    bool warm_color_key;
+    uint8_t *warm_row_filters;
+
 } pngz_t;
 
 #endif
\ No newline at end of file
@@ -1,7 +1,6 @@
 #include "save.h"
 
 #include <netinet/in.h>
-#include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <time.h>
@@ -65,55 +64,47 @@ static uint32_t crc32(uint32_t crc, const void *buf, size_t size) {
     return crc ^ ~0U;
 }
 
-static void write_chunk(FILE* fp, char* chunk_type, void* in, size_t in_size) {
-    
-    uint32_t htonl_in_size = htonl((uint32_t)in_size);
-    fwrite(&htonl_in_size, sizeof(uint32_t), 1, fp);
-    fwrite(chunk_type, sizeof(char), 4, fp);
+static uint8_t* write_chunk(uint8_t *out, const char *chunk_type,
+                           const void *in, size_t in_size) {
 
-    fwrite((uint8_t*)in, sizeof(uint8_t), in_size, fp);
+    uint32_t htonl_in_size = htonl((uint32_t)in_size);
+    memcpy(out, &htonl_in_size, sizeof(uint32_t));
+    memcpy(out+4, chunk_type, 4);
+    memcpy(out+8, in, in_size);
 
-    // Generate crc(chunk_type+data)
-    unsigned char* crcin = malloc(in_size+4);
-    memcpy(crcin, chunk_type, 4);
-    memcpy(crcin+4, (uint8_t*)in, in_size);
-    uint32_t crc = htonl(crc32(0, crcin, in_size+4));
-    free(crcin);
+    // crc(chunk_type+data), which lie next to each other in out
+    uint32_t crc = htonl(crc32(0, out+4, in_size+4));
+    memcpy(out+8+in_size, &crc, sizeof(uint32_t));
 
-    fwrite(&crc, sizeof(uint32_t), 1, fp);
+    return out+12+in_size;
 }
 
-static void write_ihdr(FILE* fp, int width, int height, int color_type,
-                       int bit_depth) {
-    uint8_t* data = calloc(13, 1);
-    ((uint32_t*)data)[0] = htonl(width);
-    ((uint32_t*)data)[1] = htonl(height);
+static uint8_t* write_ihdr(uint8_t *out, int width, int height,
+                           int color_type, int bit_depth) {
+    uint8_t data[13] = {0};
+    const uint32_t size[2] = {htonl(width), htonl(height)};
+    memcpy(data, size, 8);
     data[8] = (uint8_t)bit_depth;
     data[9] = (uint8_t)color_type;
-    write_chunk(fp, "IHDR", data, 13);
-
-    free(data);
+    return write_chunk(out, "IHDR", data, 13);
 }
 
-void save_png(const pngz_t *png) {
+// Serializes the current candidate, output_size bytes long, into
+// png->best_png.
+void save_png(pngz_t *png, size_t output_size) {
 
-    char *filename = png->options->output_filename;
+    png->best_png = realloc(png->best_png, output_size);
+    uint8_t *out = png->best_png;
 
-    FILE* fp = fopen(filename, "wb");
-    if(!fp) {
-        printf("Output file '%s' could not be opened.\n", filename);
-        exit(1);
-    }
-
-    fwrite(png_signature, sizeof(uint32_t), 2, fp);
-    write_ihdr(fp, png->width, png->height, png->color_type, png->bit_depth);
+    memcpy(out, png_signature, 8);
+    out = write_ihdr(out+8, png->width, png->height, png->color_type,
+                     png->bit_depth);
     if(png->plte_size != 0) {
-        write_chunk(fp, "PLTE", png->plte, png->plte_size);
+        out = write_chunk(out, "PLTE", png->plte, png->plte_size);
     }
     if(png->trns_size != 0) {
-        write_chunk(fp, "tRNS", png->trns, png->trns_size);
+        out = write_chunk(out, "tRNS", png->trns, png->trns_size);
     }
-    write_chunk(fp, "IDAT", png->idat, png->idat_size);
-    fwrite(iend_chunk, sizeof(uint32_t), 3, fp);
-    fclose(fp);
-}
\ No newline at end of file
+    out = write_chunk(out, "IDAT", png->idat, png->idat_size);
+    memcpy(out, iend_chunk, 12);
+}
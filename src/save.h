@@ -3,6 +3,6 @@
 
 #include "pngz.h"
 
-void save_png(const pngz_t *png);
+void save_png(pngz_t *png, size_t output_size);
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,80 @@
+#include "trace.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct trace_s {
+    FILE *fp;
+    char *image; // Already escaped for JSON
+};
+
+// Copies s with the characters JSON strings can't hold as they are escaped.
+static char* json_escape(const char *s) {
+    char *out = malloc(6*strlen(s) + 1);
+    char *p = out;
+    for(;*s;s++) {
+        const unsigned char c = *s;
+        if(c == '"' || c == '\\') {
+            *p++ = '\\';
+            *p++ = c;
+        }
+        else if(c < 0x20) {
+            p += sprintf(p, "\\u%04x", c);
+        }
+        else {
+            *p++ = c;
+        }
+    }
+    *p = '\0';
+    return out;
+}
+
+// Opens the trace file at path for appending, so runs over many images can
+// share it. Lines are written whole, so concurrent runs don't mix them up.
+// Returns NULL if path is or the file can't be opened.
+trace* trace_open(const char *path, const char *image) {
+    if(!path) {
+        return NULL;
+    }
+    FILE *fp = fopen(path, "a");
+    if(!fp) {
+        return NULL;
+    }
+    setvbuf(fp, NULL, _IOLBF, 0);
+    trace *t = malloc(sizeof(trace));
+    t->fp = fp;
+    t->image = json_escape(image);
+    return t;
+}
+
+// Writes an event: the stage, its duration and the bytes it handled, followed
+// by the optional extra members given as a printf format in fields, e.g.
+// "\"color_type\":%d".
+void trace_event(trace *t, const char *stage, double seconds, size_t bytes,
+                 const char *fields, ...) {
+    if(!t) {
+        return;
+    }
+    fprintf(t->fp, "{\"image\":\"%s\",\"stage\":\"%s\","
+            "\"seconds\":%.6f,\"bytes\":%zu",
+            t->image, stage, seconds, bytes);
+    if(fields) {
+        va_list args;
+        va_start(args, fields);
+        fputc(',', t->fp);
+        vfprintf(t->fp, fields, args);
+        va_end(args);
+    }
+    fputs("}\n", t->fp);
+}
+
+void trace_close(trace *t) {
+    if(!t) {
+        return;
+    }
+    fclose(t->fp);
+    free(t->image);
+    free(t);
+}
@@ -0,0 +1,16 @@
+#ifndef PNGZ_TRACE_H_
+#define PNGZ_TRACE_H_
+
+#include <stddef.h>
+
+// Machine readable record of where the time of one run goes: one JSON object
+// per line and event, tagged with the image. All functions accept a NULL
+// trace and then do nothing, so call sites need no checks.
+typedef struct trace_s trace;
+
+trace* trace_open(const char *path, const char *image);
+void trace_event(trace*, const char *stage, double seconds, size_t bytes,
+                 const char *fields, ...);
+void trace_close(trace*);
+
+#endif
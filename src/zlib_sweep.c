@@ -0,0 +1,179 @@
+#include "zlib_sweep.h"
+#include "zlib.h" // zlib
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The grid. Z_RLE only looks one byte back, so level doesn't change its
+// output and it runs once per memory level; memLevel also sets how many
+// symbols go in a block, which changes every strategy's output.
+static const int levels[] = {9, 6, 4, 1};
+static const int strategies[] = {Z_DEFAULT_STRATEGY, Z_FILTERED, Z_RLE};
+static const int mem_levels[] = {9, 8};
+
+#define NUM_LEVELS (sizeof(levels)/sizeof(levels[0]))
+#define NUM_STRATEGIES (sizeof(strategies)/sizeof(strategies[0]))
+#define NUM_MEM_LEVELS (sizeof(mem_levels)/sizeof(mem_levels[0]))
+#define MAX_COMBOS (NUM_LEVELS * NUM_STRATEGIES * NUM_MEM_LEVELS)
+
+typedef struct sweep_s {
+    const uint8_t *in;
+    size_t insize;
+    zlib_params combos[MAX_COMBOS];
+    size_t num_combos;
+    size_t next;          // First combination not taken by a thread
+    uint8_t *best;
+    size_t best_size;
+    size_t best_combo;
+    pthread_mutex_t lock;
+} sweep;
+
+const char* zlib_strategy_name(int strategy) {
+    switch(strategy) {
+        case Z_DEFAULT_STRATEGY: return "default";
+        case Z_FILTERED: return "filtered";
+        case Z_RLE: return "rle";
+    }
+    return "unknown";
+}
+
+// The smallest window that holds all of the input: smaller windows lose
+// matches, but one past the input only makes decoders reserve more.
+static int window_bits_for(size_t insize) {
+    int bits = 9; // zlib's smallest for deflate
+    while(bits < 15 && ((size_t)1 << bits) < insize) {
+        bits++;
+    }
+    return bits;
+}
+
+static void build_grid(sweep *s) {
+    const int window_bits = window_bits_for(s->insize);
+    size_t l, k, m;
+    s->num_combos = 0;
+    for(k=0;k<NUM_STRATEGIES;k++) {
+        for(l=0;l<NUM_LEVELS;l++) {
+            if(strategies[k] == Z_RLE && l > 0) {
+                break;
+            }
+            for(m=0;m<NUM_MEM_LEVELS;m++) {
+                zlib_params *p = &s->combos[s->num_combos++];
+                p->level = levels[l];
+                p->window_bits = window_bits;
+                p->mem_level = mem_levels[m];
+                p->strategy = strategies[k];
+            }
+        }
+    }
+}
+
+// One deflate of the input; returns 0 if zlib fails.
+static size_t compress_one(const sweep *s, const zlib_params *p,
+                           uint8_t *out, size_t out_capacity) {
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    if(deflateInit2(&stream, p->level, Z_DEFLATED, p->window_bits,
+                    p->mem_level, p->strategy) != Z_OK) {
+        return 0;
+    }
+    stream.next_in = (Bytef *)s->in;
+    stream.avail_in = s->insize;
+    stream.next_out = out;
+    stream.avail_out = out_capacity;
+    const int result = deflate(&stream, Z_FINISH);
+    const size_t size = stream.total_out;
+    deflateEnd(&stream);
+    return result == Z_STREAM_END ? size : 0;
+}
+
+// zlib's compressBound. Its own lives next to a compress() that clashes with
+// pngz's, so it can't be linked in.
+static size_t output_bound(size_t insize) {
+    return insize + (insize >> 12) + (insize >> 14) + (insize >> 25) + 13;
+}
+
+// Threads that have work, of the `threads` asked for.
+static size_t thread_count(int threads) {
+    return threads < 1 ? 1 :
+           (size_t)threads < MAX_COMBOS ? (size_t)threads : MAX_COMBOS;
+}
+
+// Each thread holds an output buffer and a deflate state, and the best
+// stream so far is held besides. deflate takes 1 << (windowBits + 2) bytes
+// of window and 1 << (memLevel + 9) of hash and pending buffers at most.
+size_t zlib_sweep_footprint(size_t insize, int threads) {
+    const size_t state = ((size_t)1 << 17) + ((size_t)1 << 18);
+    const size_t buffer = output_bound(insize);
+    return thread_count(threads) * (buffer + state) + buffer;
+}
+
+static void* sweep_worker(void *arg) {
+    sweep *s = arg;
+    const size_t capacity = output_bound(s->insize);
+    uint8_t *out = malloc(capacity);
+
+    for(;;) {
+        pthread_mutex_lock(&s->lock);
+        const size_t i = s->next++;
+        pthread_mutex_unlock(&s->lock);
+        if(i >= s->num_combos) {
+            break;
+        }
+
+        const size_t size = compress_one(s, &s->combos[i], out, capacity);
+        if(size == 0) {
+            continue;
+        }
+        // Ties go to the earlier combination, so results don't depend on
+        // which thread finishes first.
+        pthread_mutex_lock(&s->lock);
+        if(!s->best || size < s->best_size ||
+           (size == s->best_size && i < s->best_combo)) {
+            uint8_t *previous = s->best;
+            s->best = out;
+            s->best_size = size;
+            s->best_combo = i;
+            out = previous ? previous : malloc(capacity);
+        }
+        pthread_mutex_unlock(&s->lock);
+    }
+    free(out);
+    return NULL;
+}
+
+size_t zlib_sweep(const uint8_t *in, size_t insize, int threads,
+                  uint8_t **out, zlib_params *best) {
+    sweep s;
+    s.in = in;
+    s.insize = insize;
+    s.next = 0;
+    s.best = NULL;
+    s.best_size = 0;
+    s.best_combo = 0;
+    pthread_mutex_init(&s.lock, NULL);
+    build_grid(&s);
+
+    const size_t num_threads = thread_count(threads) < s.num_combos ?
+                               thread_count(threads) : s.num_combos;
+    pthread_t workers[MAX_COMBOS];
+    size_t i, started = 0;
+    // This thread is one of the workers.
+    for(i=1;i<num_threads;i++) {
+        if(pthread_create(&workers[started], NULL, sweep_worker, &s) == 0) {
+            started++;
+        }
+    }
+    sweep_worker(&s);
+    for(i=0;i<started;i++) {
+        pthread_join(workers[i], NULL);
+    }
+    pthread_mutex_destroy(&s.lock);
+
+    *out = s.best;
+    if(best && s.best) {
+        *best = s.combos[s.best_combo];
+    }
+    return s.best_size;
+}
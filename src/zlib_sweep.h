@@ -0,0 +1,31 @@
+#ifndef PNGZ_ZLIB_SWEEP_H_
+#define PNGZ_ZLIB_SWEEP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The fast compressor tier: zlib over a grid of deflateInit2 parameters,
+// keeping the smallest stream. On one thread it took 2-25x less time than
+// zopfli at -o4 on the same stream, over the 256x256 synthetic images, so it
+// also serves to estimate candidates before zopfli sees them.
+
+typedef struct zlib_params_s {
+    int level;
+    int window_bits;
+    int mem_level;
+    int strategy;
+} zlib_params;
+
+// Compresses in into a zlib stream in *out, to be freed with free(), and
+// returns its size. Parameter combinations are spread over up to `threads`
+// threads, the calling one included. If best isn't NULL it receives the
+// winning parameters.
+size_t zlib_sweep(const uint8_t *in, size_t insize, int threads,
+                  uint8_t **out, zlib_params *best);
+
+// Most memory a zlib_sweep of insize bytes on `threads` threads allocates.
+size_t zlib_sweep_footprint(size_t insize, int threads);
+
+const char* zlib_strategy_name(int strategy);
+
+#endif